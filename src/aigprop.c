@@ -11,6 +11,8 @@
 #include "aigprop.h"
 
 #include <math.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "bzlaclone.h"
 #include "bzlacore.h"
@@ -51,20 +53,75 @@ msg(char *fmt, ...)
 
 /*------------------------------------------------------------------------*/
 
+/* Literal of position 'pos'. */
+#define BZLA_AIGPROP_LIT(pos) ((int32_t)(pos) + 1)
+/* Position of literal 'lit'. */
+#define BZLA_AIGPROP_POS(lit) ((uint32_t)((lit) < 0 ? -(lit) : (lit)) - 1)
+
+static inline bool
+get_value(BzlaAIGProp *aprop, uint32_t pos)
+{
+  assert(pos < aprop->nnodes);
+  return (aprop->model[pos >> 6] >> (pos & 63)) & 1;
+}
+
+static inline void
+set_value(BzlaAIGProp *aprop, uint32_t pos, bool value)
+{
+  assert(pos < aprop->nnodes);
+  if (value)
+    aprop->model[pos >> 6] |= (uint64_t) 1 << (pos & 63);
+  else
+    aprop->model[pos >> 6] &= ~((uint64_t) 1 << (pos & 63));
+}
+
+static inline bool
+get_value_lit(BzlaAIGProp *aprop, int32_t lit)
+{
+  assert(lit);
+  return get_value(aprop, BZLA_AIGPROP_POS(lit)) == (lit > 0);
+}
+
+static inline bool
+is_var(BzlaAIGProp *aprop, uint32_t pos)
+{
+  return pos > 0 && aprop->children[2 * pos] == 0;
+}
+
+static inline uint32_t
+get_pos(BzlaAIGProp *aprop, BzlaAIG *aig)
+{
+  int32_t id;
+
+  assert(!bzla_aig_is_const(aig));
+  id = BZLA_REAL_ADDR_AIG(aig)->id;
+  return (uint32_t) id < aprop->nids ? aprop->pos[id] : 0;
+}
+
+bool
+bzla_aigprop_has_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
+{
+  assert(aprop);
+
+  if (bzla_aig_is_const(aig)) return true;
+  return aprop->model && get_pos(aprop, aig) != 0;
+}
+
 int32_t
 bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
 {
   assert(aprop);
 
   int32_t res;
-  int32_t id;
+  uint32_t pos;
 
   if (bzla_aig_is_true(aig)) return 1;
   if (bzla_aig_is_false(aig)) return -1;
 
-  id = bzla_aig_get_id(BZLA_REAL_ADDR_AIG(aig));
-  assert(bzla_hashint_map_get(aprop->model, id));
-  res = bzla_hashint_map_get(aprop->model, id)->as_int;
+  assert(aprop->model);
+  pos = get_pos(aprop, aig);
+  assert(pos);
+  res = get_value(aprop, pos) ? 1 : -1;
   res = BZLA_IS_INVERTED_AIG(aig) ? -res : res;
   return res;
 }
@@ -80,195 +137,60 @@ bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
  * score (-(-aig0 /\ -aig1), A) = max (score (-aig0), score (-aig1), A)
  */
 
-#define BZLA_AIGPROP_LOG_COMPUTE_SCORE_AIG(cur, left, right, s0, s1, res) \
-  do                                                                      \
-  {                                                                       \
-    a = bzla_aigprop_get_assignment_aig(aprop, left);                     \
-    assert(a);                                                            \
-    BZLA_AIGPROPLOG(3,                                                    \
-                    "        assignment aig0 (%s%d): %d",                 \
-                    BZLA_IS_INVERTED_AIG(left) ? "-" : "",                \
-                    BZLA_REAL_ADDR_AIG(left)->id,                         \
-                    a < 0 ? 0 : 1);                                       \
-    a = bzla_aigprop_get_assignment_aig(aprop, right);                    \
-    assert(a);                                                            \
-    BZLA_AIGPROPLOG(3,                                                    \
-                    "        assignment aig1 (%s%d): %d",                 \
-                    BZLA_IS_INVERTED_AIG(right) ? "-" : "",               \
-                    BZLA_REAL_ADDR_AIG(right)->id,                        \
-                    a < 0 ? 0 : 1);                                       \
-    BZLA_AIGPROPLOG(3,                                                    \
-                    "        score      aig0 (%s%d): %f%s",               \
-                    BZLA_IS_INVERTED_AIG(left) ? "-" : "",                \
-                    BZLA_REAL_ADDR_AIG(left)->id,                         \
-                    s0,                                                   \
-                    s0 < 1.0 ? " (< 1.0)" : "");                          \
-    BZLA_AIGPROPLOG(3,                                                    \
-                    "        score      aig1 (%s%d): %f%s",               \
-                    BZLA_IS_INVERTED_AIG(right) ? "-" : "",               \
-                    BZLA_REAL_ADDR_AIG(right)->id,                        \
-                    s1,                                                   \
-                    s1 < 1.0 ? " (< 1.0)" : "");                          \
-    BZLA_AIGPROPLOG(3,                                                    \
-                    "      * score cur (%s%d): %f%s",                     \
-                    BZLA_IS_INVERTED_AIG(cur) ? "-" : "",                 \
-                    real_cur->id,                                         \
-                    res,                                                  \
-                    res < 1.0 ? " (< 1.0)" : "");                         \
-  } while (0)
+static inline double
+get_score_lit(BzlaAIGProp *aprop, int32_t lit)
+{
+  assert(lit);
+  return lit > 0 ? aprop->score[2 * (lit - 1)]
+                 : aprop->score[2 * (-lit - 1) + 1];
+}
 
-static double
-compute_score_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
+/* Recompute the score of position 'pos' from the current assignment (AIG
+ * variables) or the scores of its children (AIG and). Returns true if the
+ * score changed. */
+static bool
+compute_score(BzlaAIGProp *aprop, uint32_t pos)
 {
   assert(aprop);
-  assert(!bzla_aig_is_const(aig));
-
-  int32_t curid, leftid, rightid;
-  double res, sleft, sright;
-  BzlaAIGPtrStack stack;
-  BzlaAIG *cur, *real_cur, *left, *right;
-  BzlaIntHashTable *mark;
-  BzlaHashTableData *d;
-  BzlaMemMgr *mm;
-#ifndef NDEBUG
-  int32_t a;
-#endif
-
-  curid = bzla_aig_get_id(aig);
-  if (bzla_hashint_map_contains(aprop->score, curid))
-    return bzla_hashint_map_get(aprop->score, curid)->as_dbl;
-
-  mm  = aprop->mm;
-  res = 0.0;
+  assert(aprop->score);
+  assert(pos > 0 && pos < aprop->nnodes);
 
-  BZLA_INIT_STACK(mm, stack);
-  mark = bzla_hashint_map_new(mm);
+  int32_t l0, l1;
+  double s, ns, s0, s1;
+  bool res;
 
-  BZLA_PUSH_STACK(stack, aig);
-  while (!BZLA_EMPTY_STACK(stack))
+  if (is_var(aprop, pos))
   {
-    cur      = BZLA_POP_STACK(stack);
-    real_cur = BZLA_REAL_ADDR_AIG(cur);
-
-    if (bzla_aig_is_const(real_cur)) continue;
-
-    curid = bzla_aig_get_id(cur);
-    if (bzla_hashint_map_contains(aprop->score, curid)) continue;
-
-    d = bzla_hashint_map_get(mark, real_cur->id);
-    if (d && d->as_int == 1) continue;
-
-    if (!d)
-    {
-      bzla_hashint_map_add(mark, real_cur->id);
-      assert(bzla_aig_is_var(real_cur) || bzla_aig_is_and(real_cur));
-      BZLA_PUSH_STACK(stack, cur);
-      if (bzla_aig_is_and(real_cur))
-      {
-        left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
-        right = bzla_aig_get_right_child(aprop->amgr, real_cur);
-        if (!bzla_aig_is_const(left)) BZLA_PUSH_STACK(stack, left);
-        if (!bzla_aig_is_const(right)) BZLA_PUSH_STACK(stack, right);
-      }
-    }
-    else
-    {
-      assert(d->as_int == 0);
-      d->as_int = 1;
-      assert(bzla_aigprop_get_assignment_aig(aprop, cur) != 0);
-#ifndef NDEBUG
-      a = bzla_aigprop_get_assignment_aig(aprop, cur);
-      assert(a);
-      BZLA_AIGPROPLOG(3, "");
-      BZLA_AIGPROPLOG(3,
-                      "  ** assignment cur (%s%d): %d",
-                      BZLA_IS_INVERTED_AIG(cur) ? "-" : "",
-                      real_cur->id,
-                      a < 0 ? 0 : 1);
-#endif
-      assert(!bzla_hashint_map_contains(aprop->score, curid));
-      assert(!bzla_hashint_map_contains(aprop->score, -curid));
-
-      if (bzla_aig_is_var(real_cur))
-      {
-        res = bzla_aigprop_get_assignment_aig(aprop, cur) < 0 ? 0.0 : 1.0;
-        BZLA_AIGPROPLOG(3,
-                        "        * score cur (%s%d): %f",
-                        BZLA_IS_INVERTED_AIG(cur) ? "-" : "",
-                        real_cur->id,
-                        res);
-        BZLA_AIGPROPLOG(3,
-                        "        * score cur (%s%d): %f",
-                        BZLA_IS_INVERTED_AIG(cur) ? "" : "-",
-                        real_cur->id,
-                        res == 0.0 ? 1.0 : 0.0);
-        bzla_hashint_map_add(aprop->score, curid)->as_dbl = res;
-        bzla_hashint_map_add(aprop->score, -curid)->as_dbl =
-            res == 0.0 ? 1.0 : 0.0;
-      }
-      else
-      {
-        assert(bzla_aig_is_and(real_cur));
-
-        left    = bzla_aig_get_left_child(aprop->amgr, real_cur);
-        right   = bzla_aig_get_right_child(aprop->amgr, real_cur);
-        leftid  = bzla_aig_get_id(left);
-        rightid = bzla_aig_get_id(right);
-
-        assert(bzla_aig_is_const(left)
-               || bzla_hashint_map_contains(aprop->score, leftid));
-        assert(bzla_aig_is_const(right)
-               || bzla_hashint_map_contains(aprop->score, rightid));
-        assert(bzla_aig_is_const(left)
-               || bzla_hashint_map_contains(aprop->score, -leftid));
-        assert(bzla_aig_is_const(right)
-               || bzla_hashint_map_contains(aprop->score, -rightid));
-
-        sleft = bzla_aig_is_const(left)
-                    ? (bzla_aig_is_true(left) ? 1.0 : 0.0)
-                    : bzla_hashint_map_get(aprop->score, leftid)->as_dbl;
-        sright = bzla_aig_is_const(right)
-                     ? (bzla_aig_is_true(right) ? 1.0 : 0.0)
-                     : bzla_hashint_map_get(aprop->score, rightid)->as_dbl;
-        res = (sleft + sright) / 2.0;
-        /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
-           choose minimum (else it might again result in 1.0) */
-        if (res == 1.0 && (sleft < 1.0 || sright < 1.0))
-          res = sleft < sright ? sleft : sright;
-        assert(res >= 0.0 && res <= 1.0);
-        bzla_hashint_map_add(aprop->score, real_cur->id)->as_dbl = res;
-#ifndef NDEBUG
-        BZLA_AIGPROP_LOG_COMPUTE_SCORE_AIG(
-            real_cur, left, right, sleft, sright, res);
-#endif
-        sleft = bzla_aig_is_const(left)
-                    ? (bzla_aig_is_true(left) ? 0.0 : 1.0)
-                    : bzla_hashint_map_get(aprop->score, -leftid)->as_dbl;
-        sright = bzla_aig_is_const(right)
-                     ? (bzla_aig_is_true(right) ? 0.0 : 1.0)
-                     : bzla_hashint_map_get(aprop->score, -rightid)->as_dbl;
-        res = sleft > sright ? sleft : sright;
-        assert(res >= 0.0 && res <= 1.0);
-        bzla_hashint_map_add(aprop->score, -real_cur->id)->as_dbl = res;
-#ifndef NDEBUG
-        BZLA_AIGPROP_LOG_COMPUTE_SCORE_AIG(BZLA_INVERT_AIG(real_cur),
-                                           BZLA_INVERT_AIG(left),
-                                           BZLA_INVERT_AIG(right),
-                                           sleft,
-                                           sright,
-                                           res);
-#endif
-      }
-      assert(bzla_hashint_map_contains(aprop->score, curid));
-      assert(bzla_hashint_map_contains(aprop->score, -curid));
-    }
+    s  = get_value(aprop, pos) ? 1.0 : 0.0;
+    ns = s == 0.0 ? 1.0 : 0.0;
+  }
+  else
+  {
+    l0 = aprop->children[2 * pos];
+    l1 = aprop->children[2 * pos + 1];
+    s0 = get_score_lit(aprop, l0);
+    s1 = get_score_lit(aprop, l1);
+    s  = (s0 + s1) / 2.0;
+    /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
+       choose minimum (else it might again result in 1.0) */
+    if (s == 1.0 && (s0 < 1.0 || s1 < 1.0)) s = s0 < s1 ? s0 : s1;
+    assert(s >= 0.0 && s <= 1.0);
+    s0 = get_score_lit(aprop, -l0);
+    s1 = get_score_lit(aprop, -l1);
+    ns = s0 > s1 ? s0 : s1;
+    assert(ns >= 0.0 && ns <= 1.0);
   }
 
-  bzla_hashint_map_delete(mark);
-  BZLA_RELEASE_STACK(stack);
+  BZLA_AIGPROPLOG(3,
+                  "      * score %d: %f, score -%d: %f",
+                  aprop->aigids[pos],
+                  s,
+                  aprop->aigids[pos],
+                  ns);
 
-  assert(bzla_hashint_map_contains(aprop->score, bzla_aig_get_id(aig)));
-  assert(bzla_hashint_map_contains(aprop->score, -bzla_aig_get_id(aig)));
+  res = aprop->score[2 * pos] != s || aprop->score[2 * pos + 1] != ns;
+  aprop->score[2 * pos]     = s;
+  aprop->score[2 * pos + 1] = ns;
   return res;
 }
 
@@ -276,428 +198,412 @@ static void
 compute_scores(BzlaAIGProp *aprop)
 {
   assert(aprop);
-  assert(aprop->roots);
   assert(aprop->model);
 
-  BzlaAIGPtrStack stack;
-  BzlaIntHashTable *cache;
-  BzlaAIG *cur, *real_cur, *left, *right;
-  BzlaIntHashTableIterator it;
-  BzlaMemMgr *mm;
+  uint32_t i;
 
   BZLA_AIGPROPLOG(3, "*** compute scores");
 
-  mm = aprop->mm;
+  if (!aprop->score) BZLA_NEWN(aprop->mm, aprop->score, 2 * aprop->nnodes);
 
-  BZLA_INIT_STACK(mm, stack);
-  cache = bzla_hashint_table_new(mm);
+  /* constant true */
+  aprop->score[0] = 1.0;
+  aprop->score[1] = 0.0;
+  /* positions are topologically sorted */
+  for (i = 1; i < aprop->nnodes; i++) compute_score(aprop, i);
+}
 
-  if (!aprop->score) aprop->score = bzla_hashint_map_new(mm);
+/*------------------------------------------------------------------------*/
 
-  /* collect roots */
-  bzla_iter_hashint_init(&it, aprop->roots);
-  while (bzla_iter_hashint_has_next(&it))
-    BZLA_PUSH_STACK(
-        stack, bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it)));
+void
+bzla_aigprop_delete_model(BzlaAIGProp *aprop)
+{
+  assert(aprop);
 
-  /* compute scores */
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    cur      = BZLA_POP_STACK(stack);
-    real_cur = BZLA_REAL_ADDR_AIG(cur);
+  if (!aprop->model) return;
+  BZLA_DELETEN(aprop->mm, aprop->model, (aprop->nnodes + 63) / 64);
+  BZLA_DELETEN(aprop->mm, aprop->children, 2 * aprop->nnodes);
+  BZLA_DELETEN(aprop->mm, aprop->aigids, aprop->nnodes);
+  BZLA_DELETEN(aprop->mm, aprop->pos, aprop->nids);
+  aprop->model    = 0;
+  aprop->children = 0;
+  aprop->aigids   = 0;
+  aprop->pos      = 0;
+  aprop->nnodes   = 0;
+  aprop->nids     = 0;
+}
 
-    if (bzla_aig_is_const(real_cur)) continue;
-    if (bzla_hashint_map_contains(aprop->score, bzla_aig_get_id(cur))) continue;
+void
+bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset)
+{
+  assert(aprop);
+  assert(aprop->model);
+  assert(aprop->children);
+
+  uint32_t i;
+  int32_t l0, l1;
+
+  /* constant true */
+  set_value(aprop, 0, true);
 
-    if (!bzla_hashint_table_contains(cache, real_cur->id))
+  /* positions are topologically sorted */
+  for (i = 1; i < aprop->nnodes; i++)
+  {
+    if (is_var(aprop, i))
     {
-      bzla_hashint_table_add(cache, real_cur->id);
-      assert(bzla_aig_is_var(real_cur) || bzla_aig_is_and(real_cur));
-      BZLA_PUSH_STACK(stack, cur);
-      if (bzla_aig_is_and(real_cur))
-      {
-        left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
-        right = bzla_aig_get_right_child(aprop->amgr, real_cur);
-        if (!bzla_aig_is_const(left)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(left)->id))
-          BZLA_PUSH_STACK(stack, left);
-        if (!bzla_aig_is_const(right)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(right)->id))
-          BZLA_PUSH_STACK(stack, right);
-      }
+      /* initialize with false */
+      if (reset) set_value(aprop, i, false);
     }
     else
     {
-      compute_score_aig(aprop, cur);
+      l0 = aprop->children[2 * i];
+      l1 = aprop->children[2 * i + 1];
+      set_value(aprop, i, get_value_lit(aprop, l0) && get_value_lit(aprop, l1));
     }
   }
-
-  /* cleanup */
-  BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(cache);
 }
 
 /*------------------------------------------------------------------------*/
 
-static void
-recursively_compute_assignment(BzlaAIGProp *aprop, BzlaAIG *aig)
+static int32_t
+compare_aig_id(const void *a, const void *b)
+{
+  int32_t x, y;
+
+  x = *(const int32_t *) a;
+  y = *(const int32_t *) b;
+  return x < y ? -1 : (x > y ? 1 : 0);
+}
+
+/* Build the flat representation of the cone of influence of the roots.
+ * Returns false if the roots are trivially unsatisfiable. */
+static bool
+init_flat(BzlaAIGProp *aprop)
 {
   assert(aprop);
-  assert(aprop->model);
-  assert(aig);
+  assert(aprop->roots);
+  assert(!aprop->model);
 
-  int32_t aleft, aright;
-  BzlaAIG *cur, *real_cur, *left, *right;
+  bool res;
+  int32_t id, lit;
+  uint32_t i, j, n, pos, *cnt;
+  BzlaIntHashTableIterator it;
+  BzlaIntStack ids;
   BzlaAIGPtrStack stack;
-  BzlaIntHashTable *cache;
+  BzlaAIG *cur, *child;
   BzlaMemMgr *mm;
 
-  if (bzla_aig_is_const(aig)) return;
+  mm  = aprop->mm;
+  res = true;
 
-  mm = aprop->mm;
+  aprop->nids = BZLA_COUNT_STACK(aprop->amgr->id2aig);
+  BZLA_CNEWN(mm, aprop->pos, aprop->nids);
 
-  cache = bzla_hashint_table_new(mm);
+  /* collect cone of roots, 'pos' is used as mark */
+  BZLA_INIT_STACK(mm, ids);
   BZLA_INIT_STACK(mm, stack);
-  BZLA_PUSH_STACK(stack, aig);
-
+  bzla_iter_hashint_init(&it, aprop->roots);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    cur = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
+    if (bzla_aig_is_const(cur)) continue;
+    BZLA_PUSH_STACK(stack, BZLA_REAL_ADDR_AIG(cur));
+  }
   while (!BZLA_EMPTY_STACK(stack))
   {
-    cur      = BZLA_POP_STACK(stack);
-    real_cur = BZLA_REAL_ADDR_AIG(cur);
-    assert(!bzla_aig_is_const(real_cur));
-    if (bzla_hashint_map_contains(aprop->model, real_cur->id)) continue;
-
-    if (bzla_aig_is_var(real_cur))
+    cur = BZLA_POP_STACK(stack);
+    assert(BZLA_IS_REGULAR_AIG(cur));
+    if (aprop->pos[cur->id]) continue;
+    aprop->pos[cur->id] = 1;
+    BZLA_PUSH_STACK(ids, cur->id);
+    if (bzla_aig_is_var(cur)) continue;
+    for (i = 0; i < 2; i++)
     {
-      /* initialize with false */
-      bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
+      child = bzla_aig_get_by_id(aprop->amgr, cur->children[i]);
+      if (bzla_aig_is_const(child)) continue;
+      child = BZLA_REAL_ADDR_AIG(child);
+      if (!aprop->pos[child->id]) BZLA_PUSH_STACK(stack, child);
     }
-    else
-    {
-      assert(bzla_aig_is_and(real_cur));
-      left  = bzla_aig_get_left_child(aprop->amgr, real_cur);
-      right = bzla_aig_get_right_child(aprop->amgr, real_cur);
+  }
+  BZLA_RELEASE_STACK(stack);
+
+  /* AIG ids are topologically ordered */
+  qsort(ids.start, BZLA_COUNT_STACK(ids), sizeof(int32_t), compare_aig_id);
+
+  n             = BZLA_COUNT_STACK(ids) + 1;
+  aprop->nnodes = n;
+  BZLA_NEWN(mm, aprop->aigids, n);
+  BZLA_CNEWN(mm, aprop->model, (n + 63) / 64);
+  BZLA_CNEWN(mm, aprop->children, 2 * n);
+  BZLA_CNEWN(mm, aprop->root, n);
+  BZLA_CNEWN(mm, aprop->unsatpos, n);
+  BZLA_CNEWN(mm, aprop->selected, n);
+  BZLA_CNEWN(mm, aprop->queued, n);
+  BZLA_CNEWN(mm, aprop->parents_start, n + 1);
+  aprop->stamp     = 0;
+  aprop->aigids[0] = 0;
+  for (i = 1; i < n; i++)
+  {
+    id               = BZLA_PEEK_STACK(ids, i - 1);
+    aprop->aigids[i] = id;
+    aprop->pos[id]   = i;
+  }
+  BZLA_RELEASE_STACK(ids);
 
-      if (!bzla_hashint_table_contains(cache, real_cur->id))
+  /* child literals and number of parents */
+  BZLA_CNEWN(mm, cnt, n);
+  for (i = 1; i < n; i++)
+  {
+    cur = bzla_aig_get_by_id(aprop->amgr, aprop->aigids[i]);
+    if (bzla_aig_is_var(cur)) continue;
+    for (j = 0; j < 2; j++)
+    {
+      child = bzla_aig_get_by_id(aprop->amgr, cur->children[j]);
+      if (bzla_aig_is_const(child))
       {
-        bzla_hashint_table_add(cache, real_cur->id);
-        BZLA_PUSH_STACK(stack, cur);
-        if (!bzla_aig_is_const(left)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(left)->id))
-          BZLA_PUSH_STACK(stack, left);
-        if (!bzla_aig_is_const(right)
-            && !bzla_hashint_table_contains(cache,
-                                            BZLA_REAL_ADDR_AIG(right)->id))
-          BZLA_PUSH_STACK(stack, right);
+        lit = bzla_aig_is_true(child) ? 1 : -1;
       }
       else
       {
-        aleft = bzla_aigprop_get_assignment_aig(aprop, left);
-        assert(aleft);
-        aright = bzla_aigprop_get_assignment_aig(aprop, right);
-        assert(aright);
-        if (aleft < 0 || aright < 0)
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = -1;
-        else
-          bzla_hashint_map_add(aprop->model, real_cur->id)->as_int = 1;
+        pos = aprop->pos[BZLA_REAL_ADDR_AIG(child)->id];
+        assert(pos && pos < i);
+        lit = BZLA_IS_INVERTED_AIG(child) ? -BZLA_AIGPROP_LIT(pos)
+                                          : BZLA_AIGPROP_LIT(pos);
+        cnt[pos] += 1;
       }
+      aprop->children[2 * i + j] = lit;
     }
   }
 
-  bzla_hashint_table_delete(cache);
-  BZLA_RELEASE_STACK(stack);
-}
-
-void
-bzla_aigprop_delete_model(BzlaAIGProp *aprop)
-{
-  assert(aprop);
-
-  if (!aprop->model) return;
-  bzla_hashint_map_delete(aprop->model);
-  aprop->model = 0;
-}
+  /* parents in CSR format */
+  for (i = 0; i < n; i++)
+    aprop->parents_start[i + 1] = aprop->parents_start[i] + cnt[i];
+  BZLA_NEWN(mm, aprop->parents, aprop->parents_start[n] + 1);
+  for (i = 0; i < n; i++) cnt[i] = aprop->parents_start[i];
+  for (i = 1; i < n; i++)
+  {
+    for (j = 0; j < 2; j++)
+    {
+      lit = aprop->children[2 * i + j];
+      if (!lit) continue;
+      pos = BZLA_AIGPROP_POS(lit);
+      if (!pos) continue;
+      aprop->parents[cnt[pos]++] = i;
+    }
+  }
+  BZLA_DELETEN(mm, cnt, n);
 
-void
-bzla_aigprop_init_model(BzlaAIGProp *aprop)
-{
-  assert(aprop);
+  /* roots */
+  bzla_iter_hashint_init(&it, aprop->roots);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    id  = bzla_iter_hashint_next(&it);
+    cur = bzla_aig_get_by_id(aprop->amgr, id);
+    if (bzla_aig_is_true(cur)) continue;
+    if (bzla_aig_is_false(cur))
+    {
+      res = false;
+      continue;
+    }
+    pos = aprop->pos[BZLA_REAL_ADDR_AIG(cur)->id];
+    assert(pos);
+    /* root and its negation */
+    if (aprop->root[pos] == (id < 0 ? 1 : -1)) res = false;
+    aprop->root[pos] = id < 0 ? -1 : 1;
+  }
 
-  if (aprop->model) bzla_aigprop_delete_model(aprop);
-  aprop->model = bzla_hashint_map_new(aprop->mm);
+  return res;
 }
 
-void
-bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset)
+static void
+delete_flat(BzlaAIGProp *aprop)
 {
   assert(aprop);
-  assert(aprop->roots);
-
-  BzlaIntHashTableIterator it;
 
-  if (reset) bzla_aigprop_init_model(aprop);
+  uint32_t n;
+  BzlaMemMgr *mm;
 
-  bzla_iter_hashint_init(&it, aprop->roots);
-  while (bzla_iter_hashint_has_next(&it))
-    recursively_compute_assignment(
-        aprop, bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it)));
+  mm = aprop->mm;
+  n  = aprop->nnodes;
+
+  if (aprop->parents)
+    BZLA_DELETEN(mm, aprop->parents, aprop->parents_start[n] + 1);
+  if (aprop->parents_start) BZLA_DELETEN(mm, aprop->parents_start, n + 1);
+  if (aprop->score) BZLA_DELETEN(mm, aprop->score, 2 * n);
+  if (aprop->root) BZLA_DELETEN(mm, aprop->root, n);
+  if (aprop->unsatpos) BZLA_DELETEN(mm, aprop->unsatpos, n);
+  if (aprop->selected) BZLA_DELETEN(mm, aprop->selected, n);
+  if (aprop->queued) BZLA_DELETEN(mm, aprop->queued, n);
+  aprop->parents       = 0;
+  aprop->parents_start = 0;
+  aprop->score         = 0;
+  aprop->root          = 0;
+  aprop->unsatpos      = 0;
+  aprop->selected      = 0;
+  aprop->queued        = 0;
+  BZLA_RESET_STACK(aprop->unsatroots);
+  BZLA_RESET_STACK(aprop->queue);
 }
 
 /*------------------------------------------------------------------------*/
 
-static inline void
-update_unsatroots_table(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
+static inline bool
+is_sat_root(BzlaAIGProp *aprop, uint32_t pos)
 {
-  assert(aprop);
-  assert(aig);
-  assert(!bzla_aig_is_const(aig));
-  assert(bzla_hashint_table_contains(aprop->roots, bzla_aig_get_id(aig))
-         || bzla_hashint_table_contains(aprop->roots, -bzla_aig_get_id(aig)));
-  assert(bzla_aigprop_get_assignment_aig(aprop, aig) != assignment);
-  assert(assignment == 1 || assignment == -1);
+  assert(aprop->root[pos]);
+  return get_value(aprop, pos) == (aprop->root[pos] > 0);
+}
 
-  uint32_t id;
+static void
+update_unsatroots(BzlaAIGProp *aprop, uint32_t pos)
+{
+  assert(aprop);
+  assert(aprop->root[pos]);
 
-  id = bzla_aig_get_id(aig);
+  uint32_t idx, last;
+  int32_t lit;
 
-  if (bzla_hashint_map_contains(aprop->unsatroots, id))
+  if (is_sat_root(aprop, pos))
   {
-    bzla_hashint_map_remove(aprop->unsatroots, id, 0);
-    assert(bzla_aigprop_get_assignment_aig(aprop, aig) == -1);
-    assert(assignment == 1);
-  }
-  else if (bzla_hashint_map_contains(aprop->unsatroots, -id))
-  {
-    bzla_hashint_map_remove(aprop->unsatroots, -id, 0);
-    assert(bzla_aigprop_get_assignment_aig(aprop, BZLA_INVERT_AIG(aig)) == -1);
-    assert(assignment == -1);
-  }
-  else if (assignment == -1)
-  {
-    bzla_hashint_map_add(aprop->unsatroots, id);
-    assert(bzla_aigprop_get_assignment_aig(aprop, aig) == 1);
+    if (!aprop->unsatpos[pos]) return;
+    /* remove, move last element into the gap */
+    idx = aprop->unsatpos[pos] - 1;
+    lit = BZLA_POP_STACK(aprop->unsatroots);
+    if (BZLA_AIGPROP_POS(lit) != pos)
+    {
+      BZLA_POKE_STACK(aprop->unsatroots, idx, lit);
+      last                  = BZLA_AIGPROP_POS(lit);
+      aprop->unsatpos[last] = idx + 1;
+    }
+    aprop->unsatpos[pos] = 0;
   }
-  else
+  else if (!aprop->unsatpos[pos])
   {
-    bzla_hashint_map_add(aprop->unsatroots, -id);
-    assert(bzla_aigprop_get_assignment_aig(aprop, BZLA_INVERT_AIG(aig)) == 1);
+    lit = aprop->root[pos] * BZLA_AIGPROP_LIT(pos);
+    BZLA_PUSH_STACK(aprop->unsatroots, lit);
+    aprop->unsatpos[pos] = BZLA_COUNT_STACK(aprop->unsatroots);
+    aprop->selected[pos] = 0;
   }
 }
 
+#ifndef NDEBUG
 static void
-update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
+check_unsatroots(BzlaAIGProp *aprop)
 {
-  assert(aprop);
-  assert(aig);
-  assert(BZLA_IS_REGULAR_AIG(aig));
-  assert(bzla_aig_is_var(aig));
-  assert(assignment == 1 || assignment == -1);
-
-  int32_t aleft, aright, ass, leftid, rightid;
   uint32_t i;
-  double start, delta, sleft, sright, s;
-  BzlaIntHashTable *cache;
-  BzlaHashTableData *d;
-  BzlaAIGPtrStack stack, cone;
-  BzlaIntStack *parents;
-  BzlaAIG *cur, *left, *right;
-  BzlaMemMgr *mm;
+  for (i = 1; i < aprop->nnodes; i++)
+  {
+    if (!aprop->root[i]) continue;
+    assert(is_sat_root(aprop, i) == (aprop->unsatpos[i] == 0));
+  }
+}
+#endif
 
-  start = bzla_util_time_stamp();
+static inline void
+queue_push(BzlaAIGProp *aprop, uint32_t pos)
+{
+  uint32_t i, p;
+  BzlaUIntStack *q;
 
-  mm = aprop->mm;
+  q = &aprop->queue;
+  BZLA_PUSH_STACK(*q, pos);
+  for (i = BZLA_COUNT_STACK(*q) - 1; i > 0; i = p)
+  {
+    p = (i - 1) / 2;
+    if (q->start[p] <= pos) break;
+    q->start[i] = q->start[p];
+  }
+  q->start[i] = pos;
+}
 
-#ifndef NDEBUG
-  BzlaIntHashTableIterator it;
-  BzlaAIG *root;
-  bzla_iter_hashint_init(&it, aprop->roots);
-  while (bzla_iter_hashint_has_next(&it))
+static inline uint32_t
+queue_pop(BzlaAIGProp *aprop)
+{
+  uint32_t i, c, n, res, last;
+  BzlaUIntStack *q;
+
+  q    = &aprop->queue;
+  res  = q->start[0];
+  last = BZLA_POP_STACK(*q);
+  n    = BZLA_COUNT_STACK(*q);
+  if (n)
   {
-    root = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
-    assert(!bzla_aig_is_false(root));
-    if ((!BZLA_IS_INVERTED_AIG(root)
-         && bzla_aigprop_get_assignment_aig(aprop, BZLA_REAL_ADDR_AIG(root))
-                == -1)
-        || (BZLA_IS_INVERTED_AIG(root)
-            && bzla_aigprop_get_assignment_aig(aprop, BZLA_REAL_ADDR_AIG(root))
-                   == 1))
+    for (i = 0; (c = 2 * i + 1) < n; i = c)
     {
-      assert(
-          bzla_hashint_map_contains(aprop->unsatroots, bzla_aig_get_id(root)));
-    }
-    else if ((!BZLA_IS_INVERTED_AIG(root)
-              && bzla_aigprop_get_assignment_aig(aprop,
-                                                 BZLA_REAL_ADDR_AIG(root))
-                     == 1)
-             || (BZLA_IS_INVERTED_AIG(root)
-                 && bzla_aigprop_get_assignment_aig(aprop,
-                                                    BZLA_REAL_ADDR_AIG(root))
-                        == -1))
-    {
-      assert(
-          !bzla_hashint_map_contains(aprop->unsatroots, bzla_aig_get_id(root)));
+      if (c + 1 < n && q->start[c + 1] < q->start[c]) c += 1;
+      if (last <= q->start[c]) break;
+      q->start[i] = q->start[c];
     }
+    q->start[i] = last;
   }
-#endif
+  return res;
+}
 
-  /* reset cone ----------------------------------------------------------- */
+static inline void
+queue_parents(BzlaAIGProp *aprop, uint32_t pos)
+{
+  uint32_t i, p;
 
-  BZLA_INIT_STACK(mm, cone);
-  BZLA_INIT_STACK(mm, stack);
-  cache = bzla_hashint_table_new(mm);
-  BZLA_PUSH_STACK(stack, aig);
-  while (!BZLA_EMPTY_STACK(stack))
+  for (i = aprop->parents_start[pos]; i < aprop->parents_start[pos + 1]; i++)
   {
-    cur = BZLA_POP_STACK(stack);
-    assert(BZLA_IS_REGULAR_AIG(cur));
-    if (bzla_hashint_table_contains(cache, cur->id)) continue;
-    bzla_hashint_table_add(cache, cur->id);
-    if (cur != aig) BZLA_PUSH_STACK(cone, cur);
-    assert(bzla_hashint_map_contains(aprop->parents, cur->id));
-    parents = bzla_hashint_map_get(aprop->parents, cur->id)->as_ptr;
-    for (i = 0; i < BZLA_COUNT_STACK(*parents); i++)
-      BZLA_PUSH_STACK(
-          stack, bzla_aig_get_by_id(aprop->amgr, BZLA_PEEK_STACK(*parents, i)));
-  }
-  BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(cache);
-
-  aprop->time.update_cone_reset += bzla_util_time_stamp() - start;
-
-  /* update assignment and score of 'aig' --------------------------------- */
-  /* update model */
-  d = bzla_hashint_map_get(aprop->model, aig->id);
-  assert(d);
-  /* update unsatroots table */
-  if (d->as_int != assignment
-      && (bzla_hashint_table_contains(aprop->roots, aig->id)
-          || bzla_hashint_table_contains(aprop->roots, -aig->id)))
-    update_unsatroots_table(aprop, aig, assignment);
-  d->as_int = assignment;
-
-  /* update score */
-  if (aprop->score)
-  {
-    d         = bzla_hashint_map_get(aprop->score, aig->id);
-    d->as_dbl = assignment < 0 ? 0.0 : 1.0;
-    d         = bzla_hashint_map_get(aprop->score, -aig->id);
-    d->as_dbl = assignment < 0 ? 1.0 : 0.0;
+    p = aprop->parents[i];
+    if (aprop->queued[p] == aprop->stamp) continue;
+    aprop->queued[p] = aprop->stamp;
+    queue_push(aprop, p);
   }
+}
 
-  qsort(cone.start,
-        BZLA_COUNT_STACK(cone),
-        sizeof(BzlaAIG *),
-        bzla_compare_aig_by_id_qsort_asc);
+/* Update assignment (and scores) of the cone of input 'pos'. Nodes are
+ * processed in topological order and the update stops at nodes whose
+ * assignment (and score) did not change. */
+static void
+update_cone(BzlaAIGProp *aprop, uint32_t pos, int32_t assignment)
+{
+  assert(aprop);
+  assert(is_var(aprop, pos));
+  assert(assignment == 1 || assignment == -1);
 
-  /* update model of cone ------------------------------------------------- */
+  bool value, changed;
+  uint32_t cur;
+  double start;
 
-  delta = bzla_util_time_stamp();
+  start = bzla_util_time_stamp();
 
-  for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
+#ifndef NDEBUG
+  check_unsatroots(aprop);
+#endif
+
+  aprop->stamp += 1;
+  if (!aprop->stamp)
   {
-    cur = BZLA_PEEK_STACK(cone, i);
-    assert(BZLA_IS_REGULAR_AIG(cur));
-    assert(bzla_aig_is_and(cur));
-    assert(bzla_hashint_map_contains(aprop->model, cur->id));
-
-    left  = bzla_aig_get_left_child(aprop->amgr, cur);
-    right = bzla_aig_get_right_child(aprop->amgr, cur);
-    aleft = bzla_aigprop_get_assignment_aig(aprop, left);
-    assert(aleft);
-    aright = bzla_aigprop_get_assignment_aig(aprop, right);
-    assert(aright);
-    ass = aleft < 0 || aright < 0 ? -1 : 1;
-    d   = bzla_hashint_map_get(aprop->model, cur->id);
-    assert(d);
-    /* update unsatroots table */
-    if (d->as_int != ass
-        && (bzla_hashint_table_contains(aprop->roots, cur->id)
-            || bzla_hashint_table_contains(aprop->roots, -cur->id)))
-      update_unsatroots_table(aprop, cur, ass);
-    d->as_int = ass;
+    BZLA_CLRN(aprop->queued, aprop->nnodes);
+    aprop->stamp = 1;
   }
 
-  aprop->time.update_cone_model_gen += bzla_util_time_stamp() - delta;
-  delta = bzla_util_time_stamp();
-
-  /* update score of cone ------------------------------------------------- */
+  set_value(aprop, pos, assignment == 1);
+  if (aprop->root[pos]) update_unsatroots(aprop, pos);
+  if (aprop->score) compute_score(aprop, pos);
+  queue_parents(aprop, pos);
 
-  if (aprop->score)
+  while (!BZLA_EMPTY_STACK(aprop->queue))
   {
-    delta = bzla_util_time_stamp();
-    for (i = 0; i < BZLA_COUNT_STACK(cone); i++)
+    cur = queue_pop(aprop);
+    assert(!is_var(aprop, cur));
+    aprop->stats.updates += 1;
+    value   = get_value_lit(aprop, aprop->children[2 * cur])
+            && get_value_lit(aprop, aprop->children[2 * cur + 1]);
+    changed = value != get_value(aprop, cur);
+    if (changed)
     {
-      cur = BZLA_PEEK_STACK(cone, i);
-      assert(BZLA_IS_REGULAR_AIG(cur));
-      assert(bzla_aig_is_and(cur));
-      assert(bzla_hashint_map_contains(aprop->score, cur->id));
-      assert(bzla_hashint_map_contains(aprop->score, -cur->id));
-
-      left    = bzla_aig_get_left_child(aprop->amgr, cur);
-      right   = bzla_aig_get_right_child(aprop->amgr, cur);
-      leftid  = bzla_aig_get_id(left);
-      rightid = bzla_aig_get_id(right);
-
-      sleft = bzla_aig_is_const(left)
-                  ? (bzla_aig_is_true(left) ? 1.0 : 0.0)
-                  : bzla_hashint_map_get(aprop->score, leftid)->as_dbl;
-      sright = bzla_aig_is_const(right)
-                   ? (bzla_aig_is_true(right) ? 1.0 : 0.0)
-                   : bzla_hashint_map_get(aprop->score, rightid)->as_dbl;
-      s = (sleft + sright) / 2.0;
-      /* fix rounding errors (eg. (0.999+1.0)/2 = 1.0) ->
-         choose minimum (else it might again result in 1.0) */
-      if (s == 1.0 && (sleft < 1.0 || sright < 1.0))
-        s = sleft < sright ? sleft : sright;
-      assert(s >= 0.0 && s <= 1.0);
-      bzla_hashint_map_get(aprop->score, cur->id)->as_dbl = s;
-
-      sleft = bzla_aig_is_const(left)
-                  ? (bzla_aig_is_true(left) ? 0.0 : 1.0)
-                  : bzla_hashint_map_get(aprop->score, -leftid)->as_dbl;
-      sright = bzla_aig_is_const(right)
-                   ? (bzla_aig_is_true(right) ? 1.0 : 0.0)
-                   : bzla_hashint_map_get(aprop->score, -rightid)->as_dbl;
-      s = sleft > sright ? sleft : sright;
-      assert(s >= 0.0 && s <= 1.0);
-      bzla_hashint_map_get(aprop->score, -cur->id)->as_dbl = s;
+      set_value(aprop, cur, value);
+      if (aprop->root[cur]) update_unsatroots(aprop, cur);
     }
-    aprop->time.update_cone_compute_score += bzla_util_time_stamp() - delta;
+    if (aprop->score && compute_score(aprop, cur)) changed = true;
+    if (changed) queue_parents(aprop, cur);
   }
 
-  BZLA_RELEASE_STACK(cone);
-
 #ifndef NDEBUG
-  bzla_iter_hashint_init(&it, aprop->roots);
-  while (bzla_iter_hashint_has_next(&it))
-  {
-    root = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
-    if ((!BZLA_IS_INVERTED_AIG(root)
-         && bzla_aigprop_get_assignment_aig(aprop, BZLA_REAL_ADDR_AIG(root))
-                == -1)
-        || (BZLA_IS_INVERTED_AIG(root)
-            && bzla_aigprop_get_assignment_aig(aprop, BZLA_REAL_ADDR_AIG(root))
-                   == 1))
-    {
-      assert(
-          bzla_hashint_map_contains(aprop->unsatroots, bzla_aig_get_id(root)));
-    }
-    else if ((!BZLA_IS_INVERTED_AIG(root)
-              && bzla_aigprop_get_assignment_aig(aprop,
-                                                 BZLA_REAL_ADDR_AIG(root))
-                     == 1)
-             || (BZLA_IS_INVERTED_AIG(root)
-                 && bzla_aigprop_get_assignment_aig(aprop,
-                                                    BZLA_REAL_ADDR_AIG(root))
-                        == -1))
-    {
-      assert(
-          !bzla_hashint_map_contains(aprop->unsatroots, bzla_aig_get_id(root)));
-    }
-  }
+  check_unsatroots(aprop);
 #endif
 
   aprop->time.update_cone += bzla_util_time_stamp() - start;
@@ -705,70 +611,55 @@ update_cone(BzlaAIGProp *aprop, BzlaAIG *aig, int32_t assignment)
 
 /*------------------------------------------------------------------------*/
 
-static BzlaAIG *
+static int32_t
 select_root(BzlaAIGProp *aprop, uint32_t nmoves)
 {
   assert(aprop);
-  assert(aprop->unsatroots);
-  assert(aprop->score);
+  assert(!BZLA_EMPTY_STACK(aprop->unsatroots));
 
-  BzlaAIG *res, *cur;
-  BzlaIntHashTableIterator it;
-  BzlaMemMgr *mm;
+  int32_t res;
 
-  mm  = aprop->mm;
   res = 0;
 
   if (aprop->use_bandit)
   {
-    int32_t *selected;
+    assert(aprop->score);
+
+    uint32_t i, pos;
+    int32_t cur;
     double value, max_value, score;
-    BzlaHashTableData *d;
 
     max_value = 0.0;
-    bzla_iter_hashint_init(&it, aprop->unsatroots);
-    while (bzla_iter_hashint_has_next(&it))
+    for (i = 0; i < BZLA_COUNT_STACK(aprop->unsatroots); i++)
     {
-      selected = &aprop->unsatroots->data[it.cur_pos].as_int;
-      cur      = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
-      assert(bzla_aigprop_get_assignment_aig(aprop, cur) != 1);
-      assert(!bzla_aig_is_const(cur));
-      d = bzla_hashint_map_get(aprop->score, bzla_aig_get_id(cur));
-      assert(d);
-      score = d->as_dbl;
+      cur = BZLA_PEEK_STACK(aprop->unsatroots, i);
+      pos = BZLA_AIGPROP_POS(cur);
+      assert(!get_value_lit(aprop, cur));
+      score = get_score_lit(aprop, cur);
       assert(score < 1.0);
       if (!res)
       {
         res = cur;
-        *selected += 1;
+        aprop->selected[pos] += 1;
         continue;
       }
-      value = score + BZLA_AIGPROP_SELECT_CFACT * sqrt(log(*selected) / nmoves);
+      value = score
+              + BZLA_AIGPROP_SELECT_CFACT
+                    * sqrt(log(aprop->selected[pos]) / nmoves);
       if (value > max_value)
       {
         res       = cur;
         max_value = value;
-        *selected *= 1;
       }
     }
   }
   else
   {
     uint32_t r;
-    BzlaAIGPtrStack stack;
-    BZLA_INIT_STACK(mm, stack);
-    bzla_iter_hashint_init(&it, aprop->unsatroots);
-    while (bzla_iter_hashint_has_next(&it))
-    {
-      cur = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
-      assert(bzla_aigprop_get_assignment_aig(aprop, cur) != 1);
-      assert(!bzla_aig_is_const(cur));
-      BZLA_PUSH_STACK(stack, cur);
-    }
-    assert(BZLA_COUNT_STACK(stack));
-    r   = bzla_rng_pick_rand(aprop->rng, 0, BZLA_COUNT_STACK(stack) - 1);
-    res = stack.start[r];
-    BZLA_RELEASE_STACK(stack);
+    r   = bzla_rng_pick_rand(
+        aprop->rng, 0, BZLA_COUNT_STACK(aprop->unsatroots) - 1);
+    res = BZLA_PEEK_STACK(aprop->unsatroots, r);
+    assert(!get_value_lit(aprop, res));
   }
 
   assert(res);
@@ -776,29 +667,26 @@ select_root(BzlaAIGProp *aprop, uint32_t nmoves)
   BZLA_AIGPROPLOG(1, "");
   BZLA_AIGPROPLOG(1,
                   "*** select root: %s%d",
-                  BZLA_IS_INVERTED_AIG(res) ? "-" : "",
-                  BZLA_REAL_ADDR_AIG(res)->id);
+                  res < 0 ? "-" : "",
+                  aprop->aigids[BZLA_AIGPROP_POS(res)]);
   return res;
 }
 
 static bool
 select_move(BzlaAIGProp *aprop,
-            BzlaAIG *root,
-            BzlaAIG **input,
+            int32_t root,
+            uint32_t *input,
             int32_t *assignment)
 {
   assert(aprop);
   assert(root);
-  assert(!bzla_aig_is_const(root));
   assert(input);
   assert(assignment);
 
   bool res;
-  int32_t i, asscur, ass[2], assnew;
-  uint32_t eidx;
+  int32_t i, cur, asscur, ass[2], assnew, c[2];
+  uint32_t eidx, pos;
   uint64_t nprops, max_nprops;
-  BzlaAIG *cur, *real_cur, *c[2];
-  BzlaHashTableData *d;
 
   *input      = 0;
   *assignment = 0;
@@ -809,10 +697,10 @@ select_move(BzlaAIGProp *aprop,
   max_nprops = aprop->nprops;
   res        = true;
 
-  if (bzla_aig_is_var(BZLA_REAL_ADDR_AIG(cur)))
+  if (is_var(aprop, BZLA_AIGPROP_POS(cur)))
   {
-    *input      = BZLA_REAL_ADDR_AIG(cur);
-    *assignment = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
+    *input      = BZLA_AIGPROP_POS(cur);
+    *assignment = cur < 0 ? -asscur : asscur;
   }
   else
   {
@@ -824,41 +712,31 @@ select_move(BzlaAIGProp *aprop,
         break;
       }
 
-      real_cur = BZLA_REAL_ADDR_AIG(cur);
-      assert(bzla_aig_is_and(real_cur));
-      asscur = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
-      c[0]   = bzla_aig_get_by_id(aprop->amgr, real_cur->children[0]);
-      c[1]   = bzla_aig_get_by_id(aprop->amgr, real_cur->children[1]);
+      pos = BZLA_AIGPROP_POS(cur);
+      assert(pos && !is_var(aprop, pos));
+      asscur = cur < 0 ? -asscur : asscur;
+      c[0]   = aprop->children[2 * pos];
+      c[1]   = aprop->children[2 * pos + 1];
 
       /* conflict */
-      if (bzla_aig_is_and(real_cur) && bzla_aig_is_const(c[0])
-          && bzla_aig_is_const(c[1]))
-        break;
+      if (!BZLA_AIGPROP_POS(c[0]) && !BZLA_AIGPROP_POS(c[1])) break;
+
+      for (i = 0; i < 2; i++) ass[i] = get_value_lit(aprop, c[i]) ? 1 : -1;
 
       /* select path and determine path assignment */
-      if (bzla_aig_is_const(c[0]))
+      if (!BZLA_AIGPROP_POS(c[0]))
         eidx = 1;
-      else if (bzla_aig_is_const(c[1]))
+      else if (!BZLA_AIGPROP_POS(c[1]))
+        eidx = 0;
+      /* choose 0-branch if exactly one branch is 0,
+       * else choose randomly */
+      else if (ass[0] == -1 && ass[1] == 1)
         eidx = 0;
+      else if (ass[0] == 1 && ass[1] == -1)
+        eidx = 1;
       else
-      {
-        /* choose 0-branch if exactly one branch is 0,
-         * else choose randomly */
-        for (i = 0; i < 2; i++)
-        {
-          assert(
-              bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id));
-          d = bzla_hashint_map_get(aprop->model, BZLA_REAL_ADDR_AIG(c[i])->id);
-          assert(d);
-          ass[i] = BZLA_IS_INVERTED_AIG(c[i]) ? -d->as_int : d->as_int;
-        }
-        if (ass[0] == -1 && ass[1] == 1)
-          eidx = 0;
-        else if (ass[0] == 1 && ass[1] == -1)
-          eidx = 1;
-        else
-          eidx = bzla_rng_pick_rand(aprop->rng, 0, 1);
-      }
+        eidx = bzla_rng_pick_rand(aprop->rng, 0, 1);
+
       if (asscur == 1)
         assnew = 1;
       else if (ass[eidx ? 0 : 1] == 1)
@@ -873,16 +751,16 @@ select_move(BzlaAIGProp *aprop,
       asscur = assnew;
       nprops += 1;
 
-      if (bzla_aig_is_var(BZLA_REAL_ADDR_AIG(cur)))
+      if (is_var(aprop, BZLA_AIGPROP_POS(cur)))
       {
-        *input      = BZLA_REAL_ADDR_AIG(cur);
-        *assignment = BZLA_IS_INVERTED_AIG(cur) ? -asscur : asscur;
+        *input      = BZLA_AIGPROP_POS(cur);
+        *assignment = cur < 0 ? -asscur : asscur;
         break;
       }
     }
   }
   aprop->stats.props = nprops;
-  return res;
+  return res && *input;
 }
 
 static int32_t
@@ -890,28 +768,21 @@ move(BzlaAIGProp *aprop, uint32_t nmoves)
 {
   assert(aprop);
   assert(aprop->roots);
-  assert(aprop->unsatroots);
   assert(aprop->model);
 
-  int32_t assignment;
-  BzlaAIG *root, *input;
+  int32_t root, assignment;
+  uint32_t input;
 
-  /* roots contain false AIG -> unsat */
-  if (!(root = select_root(aprop, nmoves))) return -1;
+  root = select_root(aprop, nmoves);
 
   if (select_move(aprop, root, &input, &assignment))
   {
     BZLA_AIGPROPLOG(1, "");
     BZLA_AIGPROPLOG(1, "*** move");
-#ifndef NDEBUG
-    int32_t a = bzla_aigprop_get_assignment_aig(aprop, input);
-    BZLA_AIGPROPLOG(1,
-                    "    * input: %s%d",
-                    BZLA_IS_INVERTED_AIG(input) ? "-" : "",
-                    BZLA_REAL_ADDR_AIG(input)->id);
-    BZLA_AIGPROPLOG(1, "      prev. assignment: %d", a);
+    BZLA_AIGPROPLOG(1, "    * input: %d", aprop->aigids[input]);
+    BZLA_AIGPROPLOG(
+        1, "      prev. assignment: %d", get_value(aprop, input) ? 1 : -1);
     BZLA_AIGPROPLOG(1, "      new   assignment: %d", assignment);
-#endif
     update_cone(aprop, input, assignment);
     aprop->stats.moves += 1;
     return 1;
@@ -928,81 +799,24 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
   assert(aprop);
   assert(roots);
 
-  double start;
-  int32_t i, j, max_steps, sat_result, rootid, childid, move_res;
-  uint32_t nmoves;
-  BzlaMemMgr *mm;
-  BzlaIntHashTable *cache;
-  BzlaIntHashTableIterator it;
-  BzlaHashTableData *d;
-  BzlaAIGPtrStack stack;
-  BzlaIntStack *childparents;
-  BzlaAIG *root, *cur, *child;
+  double start, delta;
+  int32_t j, max_steps, sat_result, move_res;
+  uint32_t i, nmoves;
 
   start      = bzla_util_time_stamp();
   sat_result = BZLA_AIGPROP_UNKNOWN;
   nmoves     = 0;
 
-  mm           = aprop->mm;
   aprop->roots = roots;
 
-  /* collect parents (for cone computation) */
-  BZLA_INIT_STACK(mm, stack);
-  cache = bzla_hashint_map_new(mm);
-  assert(!aprop->parents);
-  aprop->parents = bzla_hashint_map_new(mm);
-
-  bzla_iter_hashint_init(&it, roots);
-  while (bzla_iter_hashint_has_next(&it))
+  bzla_aigprop_delete_model(aprop);
+  delta = bzla_util_time_stamp();
+  if (!init_flat(aprop))
   {
-    cur = bzla_aig_get_by_id(aprop->amgr, bzla_iter_hashint_next(&it));
-    if (bzla_aig_is_const(cur)) continue;
-    BZLA_PUSH_STACK(stack, cur);
+    aprop->time.init += bzla_util_time_stamp() - delta;
+    goto UNSAT;
   }
-
-  while (!BZLA_EMPTY_STACK(stack))
-  {
-    cur = BZLA_REAL_ADDR_AIG(BZLA_POP_STACK(stack));
-    assert(!bzla_aig_is_const(cur));
-
-    if ((d = bzla_hashint_map_get(cache, cur->id)) && d->as_int == 1) continue;
-
-    if (!d)
-    {
-      bzla_hashint_map_add(cache, cur->id);
-      BZLA_PUSH_STACK(stack, cur);
-      BZLA_NEW(mm, childparents);
-      BZLA_INIT_STACK(mm, *childparents);
-      bzla_hashint_map_add(aprop->parents, cur->id)->as_ptr = childparents;
-      if (bzla_aig_is_and(cur))
-      {
-        for (i = 0; i < 2; i++)
-        {
-          child = bzla_aig_get_by_id(aprop->amgr, cur->children[i]);
-          if (!bzla_aig_is_const(child)) BZLA_PUSH_STACK(stack, child);
-        }
-      }
-    }
-    else
-    {
-      assert(d->as_int == 0);
-      d->as_int = 1;
-      if (bzla_aig_is_var(cur)) continue;
-      for (i = 0; i < 2; i++)
-      {
-        if (bzla_aig_is_const(
-                bzla_aig_get_by_id(aprop->amgr, cur->children[i])))
-          continue;
-        childid = cur->children[i] < 0 ? -cur->children[i] : cur->children[i];
-        assert(bzla_hashint_map_contains(aprop->parents, childid));
-        childparents = bzla_hashint_map_get(aprop->parents, childid)->as_ptr;
-        assert(childparents);
-        BZLA_PUSH_STACK(*childparents, cur->id);
-      }
-    }
-  }
-  bzla_hashint_map_delete(cache);
-  BZLA_RELEASE_STACK(stack);
+  aprop->time.init += bzla_util_time_stamp() - delta;
 
   /* generate initial model, all inputs are initialized with false */
   bzla_aigprop_generate_model(aprop, true);
@@ -1010,26 +824,17 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
   for (;;)
   {
     /* collect unsatisfied roots (kept up-to-date in update_cone) */
-    assert(!aprop->unsatroots);
-    aprop->unsatroots = bzla_hashint_map_new(mm);
-    bzla_iter_hashint_init(&it, roots);
-    while (bzla_iter_hashint_has_next(&it))
+    BZLA_RESET_STACK(aprop->unsatroots);
+    BZLA_CLRN(aprop->unsatpos, aprop->nnodes);
+    for (i = 1; i < aprop->nnodes; i++)
     {
-      rootid = bzla_iter_hashint_next(&it);
-      root   = bzla_aig_get_by_id(aprop->amgr, rootid);
-      if (bzla_aig_is_true(root)) continue;
-      if (bzla_aig_is_false(root)) goto UNSAT;
-      if (bzla_hashint_table_contains(aprop->roots, -rootid)) goto UNSAT;
-      assert(bzla_aigprop_get_assignment_aig(aprop, root));
-      if (!bzla_hashint_map_contains(aprop->unsatroots, rootid)
-          && bzla_aigprop_get_assignment_aig(aprop, root) == -1)
-        bzla_hashint_map_add(aprop->unsatroots, rootid);
+      if (aprop->root[i]) update_unsatroots(aprop, i);
     }
 
     /* compute initial score */
-    compute_scores(aprop);
+    if (aprop->use_bandit) compute_scores(aprop);
 
-    if (!aprop->unsatroots->count) goto SAT;
+    if (BZLA_EMPTY_STACK(aprop->unsatroots)) goto SAT;
 
     for (j = 0, max_steps = BZLA_AIGPROP_MAXSTEPS(aprop->stats.restarts + 1);
          !aprop->use_restarts || j < max_steps;
@@ -1042,15 +847,11 @@ bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots)
         goto UNKNOWN;
       assert(move_res == 1);
       nmoves += 1;
-      if (!aprop->unsatroots->count) goto SAT;
+      if (BZLA_EMPTY_STACK(aprop->unsatroots)) goto SAT;
     }
 
     /* restart */
     bzla_aigprop_generate_model(aprop, true);
-    bzla_hashint_map_delete(aprop->score);
-    aprop->score = 0;
-    bzla_hashint_map_delete(aprop->unsatroots);
-    aprop->unsatroots = 0;
     aprop->stats.restarts += 1;
   }
 SAT:
@@ -1062,31 +863,31 @@ UNSAT:
 UNKNOWN:
   sat_result = BZLA_AIGPROP_UNKNOWN;
 DONE:
-  bzla_iter_hashint_init(&it, aprop->parents);
-  while (bzla_iter_hashint_has_next(&it))
-  {
-    childparents = bzla_iter_hashint_next_data(&it)->as_ptr;
-    assert(childparents);
-    BZLA_RELEASE_STACK(*childparents);
-    BZLA_DELETE(mm, childparents);
-  }
-  bzla_hashint_map_delete(aprop->parents);
-  aprop->parents = 0;
-  if (aprop->unsatroots) bzla_hashint_map_delete(aprop->unsatroots);
-  aprop->unsatroots = 0;
-  aprop->roots      = 0;
-  if (aprop->score) bzla_hashint_map_delete(aprop->score);
-  aprop->score = 0;
+  /* keep model, AIG id to position map and child literals only (required
+   * to regenerate the model) */
+  delete_flat(aprop);
+  aprop->roots = 0;
 
   aprop->time.sat += bzla_util_time_stamp() - start;
   return sat_result;
 }
 
+#define BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, field, n)                 \
+  do                                                                       \
+  {                                                                        \
+    if ((aprop)->field)                                                    \
+    {                                                                      \
+      BZLA_NEWN((mm), (res)->field, (n));                                  \
+      memcpy((res)->field, (aprop)->field, (n) * sizeof(*(aprop)->field)); \
+    }                                                                      \
+  } while (0)
+
 BzlaAIGProp *
 bzla_aigprop_clone_aigprop(BzlaAIGMgr *clone, BzlaAIGProp *aprop)
 {
   assert(clone);
 
+  uint32_t n;
   BzlaAIGProp *res;
   BzlaMemMgr *mm;
 
@@ -1098,12 +899,29 @@ bzla_aigprop_clone_aigprop(BzlaAIGMgr *clone, BzlaAIGProp *aprop)
   res->mm   = mm;
   res->rng  = bzla_rng_clone(aprop->rng, mm);
   res->amgr = clone;
-  res->unsatroots =
-      bzla_hashint_map_clone(mm, aprop->unsatroots, bzla_clone_data_as_int, 0);
-  res->score =
-      bzla_hashint_map_clone(mm, aprop->score, bzla_clone_data_as_dbl, 0);
-  res->model =
-      bzla_hashint_map_clone(mm, aprop->model, bzla_clone_data_as_int, 0);
+
+  n = aprop->nnodes;
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, pos, aprop->nids);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, aigids, n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, model, (n + 63) / 64);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, children, 2 * n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, parents_start, n + 1);
+  if (aprop->parents_start)
+  {
+    BZLA_AIGPROP_CLONE_ARRAY(
+        mm, res, aprop, parents, aprop->parents_start[n] + 1);
+  }
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, score, 2 * n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, root, n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, unsatpos, n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, selected, n);
+  BZLA_AIGPROP_CLONE_ARRAY(mm, res, aprop, queued, n);
+
+  BZLA_INIT_STACK(mm, res->unsatroots);
+  for (n = 0; n < BZLA_COUNT_STACK(aprop->unsatroots); n++)
+    BZLA_PUSH_STACK(res->unsatroots, BZLA_PEEK_STACK(aprop->unsatroots, n));
+  BZLA_INIT_STACK(mm, res->queue);
+  assert(BZLA_EMPTY_STACK(aprop->queue));
   return res;
 }
 
@@ -1130,6 +948,8 @@ bzla_aigprop_new_aigprop(BzlaAIGMgr *amgr,
   res->use_restarts = use_restarts;
   res->use_bandit   = use_bandit;
   res->nprops       = nprops;
+  BZLA_INIT_STACK(mm, res->unsatroots);
+  BZLA_INIT_STACK(mm, res->queue);
 
   return res;
 }
@@ -1141,9 +961,10 @@ bzla_aigprop_delete_aigprop(BzlaAIGProp *aprop)
   BzlaMemMgr *mm;
 
   bzla_rng_delete(aprop->rng);
-  if (aprop->unsatroots) bzla_hashint_map_delete(aprop->unsatroots);
-  if (aprop->score) bzla_hashint_map_delete(aprop->score);
-  if (aprop->model) bzla_hashint_map_delete(aprop->model);
+  delete_flat(aprop);
+  bzla_aigprop_delete_model(aprop);
+  BZLA_RELEASE_STACK(aprop->unsatroots);
+  BZLA_RELEASE_STACK(aprop->queue);
   mm = aprop->mm;
   BZLA_DELETE(mm, aprop);
   bzla_mem_mgr_delete(mm);
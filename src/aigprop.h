@@ -15,6 +15,7 @@
 #include "utils/bzlahashptr.h"
 #include "utils/bzlamem.h"
 #include "utils/bzlarng.h"
+#include "utils/bzlastack.h"
 
 #define BZLA_AIGPROP_UNKNOWN 0
 #define BZLA_AIGPROP_SAT 10
@@ -24,12 +25,47 @@ struct BzlaAIGProp
 {
   BzlaAIGMgr *amgr;
   BzlaIntHashTable *roots;
-  BzlaIntHashTable *unsatroots;
-  BzlaIntHashTable *score;
-  BzlaIntHashTable *model;
-  BzlaIntHashTable *parents;
   BzlaMemMgr *mm;
 
+  /* Flat representation of the cone of influence of the roots.
+   *
+   * AIGs are stored in topological order (ascending AIG id), position 0 is
+   * reserved for constant true. Within the flat representation, AIGs are
+   * referred to by literals lit = +/-(pos + 1), where a negative literal
+   * denotes the inverted AIG. */
+  uint32_t nnodes; /* number of positions (including constant true) */
+  uint32_t nids;   /* size of 'pos' */
+  uint32_t *pos;   /* maps AIG id to position, 0 if not in cone */
+  int32_t *aigids; /* maps position to AIG id */
+  /* Maps position p to its child literals children[2p] and children[2p+1],
+   * both 0 if p is an AIG variable. Kept together with the model after
+   * 'bzla_aigprop_sat' to allow regenerating the model. */
+  int32_t *children;
+  /* Parents of position p (CSR format), stored at
+   * parents[parents_start[p]] ... parents[parents_start[p + 1] - 1]. */
+  uint32_t *parents_start;
+  uint32_t *parents;
+  /* Bit-packed assignment, one bit per position. */
+  uint64_t *model;
+  /* Score of position p (score[2p]) and its negation (score[2p + 1]),
+   * only maintained if 'use_bandit' is enabled. */
+  double *score;
+
+  /* Maps position to 1 (root), -1 (inverted root) or 0 (no root). */
+  int8_t *root;
+  /* Literals of currently unsatisfied roots. */
+  BzlaIntStack unsatroots;
+  /* Maps position to its index in 'unsatroots' + 1, 0 if not unsatisfied. */
+  uint32_t *unsatpos;
+  /* Maps position to the number of times it was selected as root. */
+  uint32_t *selected;
+
+  /* Priority queue (binary min-heap over positions) for cone updates. */
+  BzlaUIntStack queue;
+  /* Maps position to the stamp of the cone update it was last queued in. */
+  uint32_t *queued;
+  uint32_t stamp;
+
   BzlaRNG *rng;
 
   uint32_t loglevel;
@@ -43,15 +79,14 @@ struct BzlaAIGProp
     uint32_t moves;
     uint64_t props;
     uint32_t restarts;
+    uint64_t updates;
   } stats;
 
   struct
   {
     double sat;
+    double init;
     double update_cone;
-    double update_cone_reset;
-    double update_cone_model_gen;
-    double update_cone_compute_score;
   } time;
 };
 
@@ -67,8 +102,12 @@ BzlaAIGProp *bzla_aigprop_new_aigprop(BzlaAIGMgr *amgr,
 BzlaAIGProp *bzla_aigprop_clone_aigprop(BzlaAIGMgr *clone, BzlaAIGProp *aprop);
 void bzla_aigprop_delete_aigprop(BzlaAIGProp *aprop);
 
+/* Return true if 'aig' is in the cone of the roots of the last sat call, i.e.,
+ * if it has an assignment. */
+bool bzla_aigprop_has_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig);
 int32_t bzla_aigprop_get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig);
 void bzla_aigprop_generate_model(BzlaAIGProp *aprop, bool reset);
+void bzla_aigprop_delete_model(BzlaAIGProp *aprop);
 
 int32_t bzla_aigprop_sat(BzlaAIGProp *aprop, BzlaIntHashTable *roots);
 
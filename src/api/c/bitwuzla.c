@@ -50,6 +50,8 @@ struct Bitwuzla
   BitwuzlaConstSortPtrStack d_fun_domain_sorts;
   /* Domain sorts of current bitwuzla_sort_fun_get_domain_sorts query. */
   BitwuzlaConstSortPtrStack d_sort_fun_domain_sorts;
+  /* Values populated by bitwuzla_get_values. */
+  BitwuzlaTermConstPtrStack d_values;
   /* String populated by bitwuzla_get_bv_value. */
   char *d_bv_value;
   /* Strings populated by bitwuzla_get_fp_value. */
@@ -58,6 +60,8 @@ struct Bitwuzla
   /* Strings populated by bitwuzla_get_array_value. */
   BitwuzlaTermConstPtrStack d_array_indices;
   BitwuzlaTermConstPtrStack d_array_values;
+  /* Upper bounds populated by bitwuzla_get_array_value_ranges. */
+  BitwuzlaTermConstPtrStack d_array_uppers;
   /* Strings populated by bitwuzla_get_fun_value. */
   BitwuzlaTermConstPtrStack d_fun_args;
   BitwuzlaTermConstPtrPtrStack d_fun_args_ptr;
@@ -89,15 +93,23 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_DECLSORT_BV_WIDTH]       = BZLA_OPT_DECLSORT_BV_WIDTH,
     [BITWUZLA_OPT_ENGINE]                  = BZLA_OPT_ENGINE,
     [BITWUZLA_OPT_EXIT_CODES]              = BZLA_OPT_EXIT_CODES,
+    [BITWUZLA_OPT_FP_LAZY_WORD_BLAST]      = BZLA_OPT_FP_LAZY_WORD_BLAST,
+    [BITWUZLA_OPT_FP_WORD_BLAST_TEMPLATES] = BZLA_OPT_FP_WORD_BLAST_TEMPLATES,
     [BITWUZLA_OPT_FUN_DUAL_PROP]           = BZLA_OPT_FUN_DUAL_PROP,
     [BITWUZLA_OPT_FUN_DUAL_PROP_QSORT]     = BZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BITWUZLA_OPT_FUN_EAGER_LEMMAS]        = BZLA_OPT_FUN_EAGER_LEMMAS,
+    [BITWUZLA_OPT_FUN_HYBRID]              = BZLA_OPT_FUN_HYBRID,
     [BITWUZLA_OPT_FUN_JUST]                = BZLA_OPT_FUN_JUST,
     [BITWUZLA_OPT_FUN_JUST_HEURISTIC]      = BZLA_OPT_FUN_JUST_HEURISTIC,
+    [BITWUZLA_OPT_FUN_PREFPLS]             = BZLA_OPT_FUN_PREFPLS,
     [BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BITWUZLA_OPT_FUN_PREPROP]             = BZLA_OPT_FUN_PREPROP,
     [BITWUZLA_OPT_FUN_PRESLS]              = BZLA_OPT_FUN_PRESLS,
     [BITWUZLA_OPT_FUN_STORE_LAMBDAS]       = BZLA_OPT_FUN_STORE_LAMBDAS,
+    [BITWUZLA_OPT_FUN_WEG]                 = BZLA_OPT_FUN_WEG,
+    [BITWUZLA_OPT_FUN_LAZY_MODEL]          = BZLA_OPT_FUN_LAZY_MODEL,
+    [BITWUZLA_OPT_FUN_DYNAMIC_ACK]         = BZLA_OPT_FUN_DYNAMIC_ACK,
+    [BITWUZLA_OPT_FUN_BETA_CACHE]          = BZLA_OPT_FUN_BETA_CACHE,
     [BITWUZLA_OPT_INCREMENTAL]             = BZLA_OPT_INCREMENTAL,
     [BITWUZLA_OPT_INPUT_FORMAT]            = BZLA_OPT_INPUT_FORMAT,
     [BITWUZLA_OPT_LOGLEVEL]                = BZLA_OPT_LOGLEVEL,
@@ -106,6 +118,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
     [BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BITWUZLA_OPT_PARSE_INTERACTIVE]       = BZLA_OPT_PARSE_INTERACTIVE,
     [BITWUZLA_OPT_PP_ACKERMANN]            = BZLA_OPT_PP_ACKERMANN,
+    [BITWUZLA_OPT_PP_ACKERMANN_LIMIT]      = BZLA_OPT_PP_ACKERMANN_LIMIT,
     [BITWUZLA_OPT_PP_BETA_REDUCE]          = BZLA_OPT_PP_BETA_REDUCE,
     [BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BITWUZLA_OPT_PP_ELIMINATE_ITES]       = BZLA_OPT_PP_ELIMINATE_ITES,
@@ -129,6 +142,7 @@ static BzlaOption bzla_options[BITWUZLA_OPT_NUM_OPTS] = {
         BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BITWUZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
         BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
+    [BITWUZLA_OPT_PROP_FUN]                 = BZLA_OPT_PROP_FUN,
     [BITWUZLA_OPT_PROP_INFER_INEQ_BOUNDS]   = BZLA_OPT_PROP_INFER_INEQ_BOUNDS,
     [BITWUZLA_OPT_PROP_NO_MOVE_ON_CONFLICT] = BZLA_OPT_PROP_NO_MOVE_ON_CONFLICT,
     [BITWUZLA_OPT_PROP_NPROPS]              = BZLA_OPT_PROP_NPROPS,
@@ -206,15 +220,23 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
+    [BZLA_OPT_FP_LAZY_WORD_BLAST]      = BITWUZLA_OPT_FP_LAZY_WORD_BLAST,
+    [BZLA_OPT_FP_WORD_BLAST_TEMPLATES] = BITWUZLA_OPT_FP_WORD_BLAST_TEMPLATES,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
     [BZLA_OPT_FUN_DUAL_PROP_QSORT]     = BITWUZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
+    [BZLA_OPT_FUN_HYBRID]              = BITWUZLA_OPT_FUN_HYBRID,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_PREFPLS]             = BITWUZLA_OPT_FUN_PREFPLS,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
+    [BZLA_OPT_FUN_WEG]                 = BITWUZLA_OPT_FUN_WEG,
+    [BZLA_OPT_FUN_LAZY_MODEL]          = BITWUZLA_OPT_FUN_LAZY_MODEL,
+    [BZLA_OPT_FUN_DYNAMIC_ACK]         = BITWUZLA_OPT_FUN_DYNAMIC_ACK,
+    [BZLA_OPT_FUN_BETA_CACHE]          = BITWUZLA_OPT_FUN_BETA_CACHE,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
@@ -223,6 +245,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
+    [BZLA_OPT_PP_ACKERMANN_LIMIT]      = BITWUZLA_OPT_PP_ACKERMANN_LIMIT,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BZLA_OPT_PP_ELIMINATE_ITES]       = BITWUZLA_OPT_PP_ELIMINATE_ITES,
@@ -245,6 +268,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
+    [BZLA_OPT_PROP_FUN]                 = BITWUZLA_OPT_PROP_FUN,
     [BZLA_OPT_PROP_INFER_INEQ_BOUNDS]   = BITWUZLA_OPT_PROP_INFER_INEQ_BOUNDS,
     [BZLA_OPT_PROP_NO_MOVE_ON_CONFLICT] = BITWUZLA_OPT_PROP_NO_MOVE_ON_CONFLICT,
     [BZLA_OPT_PROP_NPROPS]              = BITWUZLA_OPT_PROP_NPROPS,
@@ -1020,8 +1044,10 @@ init(Bitwuzla *bitwuzla, BzlaMemMgr *mm)
   BZLA_INIT_STACK(mm, bitwuzla->d_term_children);
   BZLA_INIT_STACK(mm, bitwuzla->d_fun_domain_sorts);
   BZLA_INIT_STACK(mm, bitwuzla->d_sort_fun_domain_sorts);
+  BZLA_INIT_STACK(mm, bitwuzla->d_values);
   BZLA_INIT_STACK(mm, bitwuzla->d_array_indices);
   BZLA_INIT_STACK(mm, bitwuzla->d_array_values);
+  BZLA_INIT_STACK(mm, bitwuzla->d_array_uppers);
   BZLA_INIT_STACK(mm, bitwuzla->d_fun_args);
   BZLA_INIT_STACK(mm, bitwuzla->d_fun_args_ptr);
   BZLA_INIT_STACK(mm, bitwuzla->d_fun_values);
@@ -1057,8 +1083,10 @@ reset(Bitwuzla *bitwuzla)
   BZLA_RELEASE_STACK(bitwuzla->d_term_children);
   BZLA_RELEASE_STACK(bitwuzla->d_fun_domain_sorts);
   BZLA_RELEASE_STACK(bitwuzla->d_sort_fun_domain_sorts);
+  BZLA_RELEASE_STACK(bitwuzla->d_values);
   BZLA_RELEASE_STACK(bitwuzla->d_array_indices);
   BZLA_RELEASE_STACK(bitwuzla->d_array_values);
+  BZLA_RELEASE_STACK(bitwuzla->d_array_uppers);
   BZLA_RELEASE_STACK(bitwuzla->d_fun_args);
   BZLA_RELEASE_STACK(bitwuzla->d_fun_args_ptr);
   BZLA_RELEASE_STACK(bitwuzla->d_fun_values);
@@ -3074,6 +3102,52 @@ bitwuzla_get_value(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
   BZLA_RETURN_BITWUZLA_TERM(res);
 }
 
+const BitwuzlaTerm **
+bitwuzla_get_values(Bitwuzla *bitwuzla,
+                    size_t size,
+                    const BitwuzlaTerm *terms[])
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_ARG_NOT_NULL(terms);
+
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  BZLA_CHECK_OPT_PRODUCE_MODELS(bzla);
+  BZLA_CHECK_SAT(bzla, "retrieve model");
+  BZLA_ABORT(bzla->quantifiers->count,
+             "'get-value' is currently not supported with quantifiers");
+
+  BZLA_RESET_STACK(bitwuzla->d_values);
+  if (size == 0)
+  {
+    return bitwuzla->d_values.start;
+  }
+
+  BzlaNodePtrStack bzla_terms;
+  BzlaNode **bzla_values;
+  BZLA_INIT_STACK(bitwuzla->d_mm, bzla_terms);
+  for (size_t i = 0; i < size; i++)
+  {
+    BZLA_CHECK_ARG_NOT_NULL_AT_IDX(terms[i], i);
+    BzlaNode *bzla_term = BZLA_IMPORT_BITWUZLA_TERM(terms[i]);
+    assert(bzla_node_get_ext_refs(bzla_term));
+    BZLA_CHECK_TERM_BZLA(bzla, bzla_term);
+    BZLA_PUSH_STACK(bzla_terms, bzla_term);
+  }
+
+  BZLA_NEWN(bitwuzla->d_mm, bzla_values, size);
+  bzla_model_get_values(bzla, bzla_terms.start, size, bzla_values);
+
+  for (size_t i = 0; i < size; i++)
+  {
+    bzla_node_inc_ext_ref_counter(bzla, bzla_values[i]);
+    BZLA_PUSH_STACK(bitwuzla->d_values,
+                    BZLA_EXPORT_BITWUZLA_TERM(bzla_values[i]));
+  }
+  BZLA_DELETEN(bitwuzla->d_mm, bzla_values, size);
+  BZLA_RELEASE_STACK(bzla_terms);
+  return bitwuzla->d_values.start;
+}
+
 const char *
 bitwuzla_get_bv_value(Bitwuzla *bitwuzla, const BitwuzlaTerm *term)
 {
@@ -3254,6 +3328,87 @@ bitwuzla_get_array_value(Bitwuzla *bitwuzla,
   BZLA_RELEASE_STACK(_values);
 }
 
+void
+bitwuzla_get_array_value_ranges(Bitwuzla *bitwuzla,
+                                const BitwuzlaTerm *term,
+                                const BitwuzlaTerm ***lowers,
+                                const BitwuzlaTerm ***uppers,
+                                const BitwuzlaTerm ***values,
+                                size_t *size,
+                                const BitwuzlaTerm **default_value)
+{
+  BZLA_CHECK_ARG_NOT_NULL(bitwuzla);
+  BZLA_CHECK_ARG_NOT_NULL(term);
+  BZLA_CHECK_ARG_NOT_NULL(lowers);
+  BZLA_CHECK_ARG_NOT_NULL(uppers);
+  BZLA_CHECK_ARG_NOT_NULL(values);
+  BZLA_CHECK_ARG_NOT_NULL(size);
+  BZLA_CHECK_ARG_NOT_NULL(default_value);
+
+  Bzla *bzla = BZLA_IMPORT_BITWUZLA(bitwuzla);
+  BZLA_CHECK_OPT_PRODUCE_MODELS(bzla);
+  BZLA_CHECK_SAT(bzla, "retrieve model");
+  BZLA_ABORT(bzla->quantifiers->count,
+             "'get-value' is currently not supported with quantifiers");
+
+  BzlaNode *bzla_term = BZLA_IMPORT_BITWUZLA_TERM(term);
+  assert(bzla_node_get_ext_refs(bzla_term));
+  BZLA_CHECK_TERM_BZLA(bzla, bzla_term);
+  BZLA_ABORT(!bzla_node_is_array(bzla_term), "given term is not an array term");
+
+  *lowers        = 0;
+  *uppers        = 0;
+  *values        = 0;
+  *size          = 0;
+  *default_value = 0;
+
+  BzlaArrayModel *model = bzla_model_get_array_model_compact(bzla, bzla_term);
+  if (!model)
+  {
+    return;
+  }
+
+  BzlaSortId sort       = bzla_node_get_sort_id(bzla_term);
+  BzlaSortId index_sort = bzla_sort_array_get_index(bzla, sort);
+  BzlaSortId value_sort = bzla_sort_array_get_element(bzla, sort);
+  BzlaNode *lower, *upper, *value;
+
+  BZLA_RESET_STACK(bitwuzla->d_array_indices);
+  BZLA_RESET_STACK(bitwuzla->d_array_uppers);
+  BZLA_RESET_STACK(bitwuzla->d_array_values);
+
+  for (uint32_t i = 0; i < model->num_runs; ++i)
+  {
+    lower = bzla_node_mk_value(bzla, index_sort, model->runs[i].lower);
+    upper = bzla_node_mk_value(bzla, index_sort, model->runs[i].upper);
+    value = bzla_node_mk_value(bzla, value_sort, model->runs[i].value);
+    BZLA_PUSH_STACK(bitwuzla->d_array_indices,
+                    BZLA_EXPORT_BITWUZLA_TERM(lower));
+    bzla_node_inc_ext_ref_counter(bzla, lower);
+    BZLA_PUSH_STACK(bitwuzla->d_array_uppers, BZLA_EXPORT_BITWUZLA_TERM(upper));
+    bzla_node_inc_ext_ref_counter(bzla, upper);
+    BZLA_PUSH_STACK(bitwuzla->d_array_values, BZLA_EXPORT_BITWUZLA_TERM(value));
+    bzla_node_inc_ext_ref_counter(bzla, value);
+  }
+
+  *size = model->num_runs;
+
+  if (*size)
+  {
+    *lowers = bitwuzla->d_array_indices.start;
+    *uppers = bitwuzla->d_array_uppers.start;
+    *values = bitwuzla->d_array_values.start;
+  }
+
+  if (model->default_value)
+  {
+    value = bzla_node_mk_value(bzla, value_sort, model->default_value);
+    *default_value = BZLA_EXPORT_BITWUZLA_TERM(value);
+    bzla_node_inc_ext_ref_counter(bzla, value);
+  }
+  bzla_model_delete_array_model_compact(bzla, model);
+}
+
 void
 bitwuzla_get_fun_value(Bitwuzla *bitwuzla,
                        const BitwuzlaTerm *term,
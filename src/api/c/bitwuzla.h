@@ -256,6 +256,22 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PP_ACKERMANN,
 
+  /*! **Ackermannization preprocessing:
+   *    Cost limit.**
+   *
+   * Only add Ackermann constraints for functions that require at most this
+   * many constraints (i.e., functions with at most n applications where
+   * n * (n - 1) / 2 does not exceed the limit). Functions with more
+   * applications are left to lemmas on demand.
+   * Only effective if `::BITWUZLA_OPT_PP_ACKERMANN` is enabled.
+   *
+   * Values:
+   *  * An unsigned integer value, no limit if 0 (**default**: 0).
+   *
+   *  @warning This is an expert option to configure preprocessing.
+   */
+  BITWUZLA_OPT_PP_ACKERMANN_LIMIT,
+
   /*! **Beta reduction preprocessing.**
    *
    * Eager elimination of lambda terms via beta reduction.
@@ -505,11 +521,35 @@ enum BitwuzlaOption
    *    another conflict is found.
    *  * **all**:
    *    In each refinement iteration, generate lemmas for all conflicts.
+   *  * **batch**:
+   *    In each refinement iteration, generate lemmas for all function
+   *    congruence, beta reduction and extensionality conflicts reachable
+   *    from the current model and add them in one batch.
    *
    *  @warning This is an expert option to configure the func solver engine.
    */
   BITWUZLA_OPT_FUN_EAGER_LEMMAS,
 
+  /*! **Function solver engine:
+   *    Hybrid local search and bit-blasting.**
+   *
+   * When function solver engine is enabled and either
+   * ::BITWUZLA_OPT_FUN_PREPROP or ::BITWUZLA_OPT_FUN_PRESLS is enabled,
+   * interleave bounded runs of the local search engine with bounded calls to
+   * the SAT solver (with geometrically increasing limits). Current local
+   * search assignments are used as phases for the next SAT call (if supported
+   * by the SAT solver) and bits fixed by the SAT solver are used as constant
+   * bits in the next propagation-based local search run (if
+   * ::BITWUZLA_OPT_PROP_CONST_BITS is enabled).
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_HYBRID,
+
   /*! **Function solver engine:
    *    Lazy synthesis.**
    *
@@ -552,6 +592,27 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_FUN_JUST_HEURISTIC,
 
+  /*! **Function solver engine:
+   *    Floating-point local search sequential portfolio.**
+   *
+   * When function solver engine is enabled, configure floating-point level
+   * local search as preprocessing step within sequential portfolio setting.
+   * During local search, floating-point terms are evaluated concretely
+   * instead of via their word-blasted circuits. If a satisfying assignment
+   * is found, it is confirmed with a SAT call on the word-blasted formula
+   * under the assumption of that assignment, i.e., the formula is still
+   * word-blasted in full (this is required for model construction).
+   * Only applies to formulas over floating-point, rounding mode and Boolean
+   * inputs.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_PREFPLS,
+
   /*! **Function solver engine:
    *    Propagation-based local search sequential portfolio.**
    *
@@ -595,6 +656,70 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_FUN_STORE_LAMBDAS,
 
+  /*! **Function solver engine:
+   *    Weak equivalence index over store chains.**
+   *
+   * Propagate reads over chains of array stores via an index that maps
+   * each store to the nearest store below it with the same index value
+   * (weak equivalence), instead of visiting each store of the chain.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_WEG,
+
+  /*! **Function solver engine:
+   *    Lazy model generation.**
+   *
+   * Do not compute model values for all nodes after a satisfiable check,
+   * but compute (and cache) model values only for the terms queried via
+   * `bitwuzla_get_value()` and friends (and the terms below them).
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_LAZY_MODEL,
+
+  /*! **Function solver engine:
+   *    Dynamic Ackermannization.**
+   *
+   * Switch an uninterpreted function from lemmas on demand to eager
+   * Ackermannization once the number of function congruence lemmas
+   * generated for it reaches this threshold. The Ackermann constraints for
+   * all applications of the function are then added at once. Functions that
+   * exceed the cost limit configured via `::BITWUZLA_OPT_PP_ACKERMANN_LIMIT`
+   * are never expanded.
+   *
+   * Values:
+   *  * An unsigned integer value, disabled if 0 (**default**: 0).
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_DYNAMIC_ACK,
+
+  /*! **Function solver engine:
+   *    Beta reduction cache.**
+   *
+   * Cache the results of partial beta reduction of lambdas (w.r.t. the
+   * arguments of an application) together with the conditions that were
+   * evaluated to derive them. A cached result is reused as long as all
+   * recorded conditions still hold under the current model. The cache is
+   * kept across refinement iterations and incremental calls.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the func solver engine.
+   */
+  BITWUZLA_OPT_FUN_BETA_CACHE,
+
   /* --------------------- SLS Engine Options (Expert) --------------------- */
 
   /*! **Stochastic local search solver engine:
@@ -954,6 +1079,23 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
 
+  /*! **Propagation-based local search solver engine:
+   *    Support for arrays and uninterpreted functions.**
+   *
+   * When enabled, the prop engine is also used on formulas with arrays and
+   * uninterpreted functions (no lambdas, no function equalities). Function
+   * applications are treated as inputs, and their assignments are repaired to
+   * be consistent w.r.t. function congruence and array updates whenever all
+   * roots are satisfied.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option to configure the prop solver engine.
+   */
+  BITWUZLA_OPT_PROP_FUN,
+
   /*! **Propagation-based local search solver engine:
    *    Infer bounds for inequalities for value computation.**
    *
@@ -1465,6 +1607,44 @@ enum BitwuzlaOption
    */
   BITWUZLA_OPT_DECLSORT_BV_WIDTH,
 
+  /*! **Lazy word-blasting of expensive floating-point operators.**
+   *
+   * Abstract fp.div, fp.sqrt, fp.rem and fp.fma by fresh variables
+   * constrained by cheap axioms (NaN, infinity, zero and sign propagation).
+   * Instances whose abstraction is inconsistent with the concrete operation
+   * under the current model are word-blasted on demand. Only effective with
+   * engine **fun** (see ::BITWUZLA_OPT_ENGINE) and if neither
+   * ::BITWUZLA_OPT_FUN_PREPROP, ::BITWUZLA_OPT_FUN_PRESLS,
+   * ::BITWUZLA_OPT_FUN_PREFPLS nor ::BITWUZLA_OPT_FUN_DUAL_PROP are enabled.
+   *
+   * Values:
+   *  * **1**: enable
+   *  * **0**: disable [**default**]
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_FP_LAZY_WORD_BLAST,
+
+  /*! **Cache word-blasting templates for floating-point operators.**
+   *
+   * Word-blast fp.add, fp.mul, fp.div, fp.fma and fp.sqrt once per
+   * operator, floating-point sort and rounding mode (if constant) over
+   * fresh bit-vector variables, and instantiate further occurrences by
+   * substitution rather than regenerating the circuit.
+   *
+   * This only reduces the time spent on constructing circuits via SymFPU,
+   * not memory: every instance is still a full copy of the circuit, and the
+   * template circuits are kept alive in addition for the lifetime of the
+   * solver instance.
+   *
+   * Values:
+   *  * **1**: enable [**default**]
+   *  * **0**: disable
+   *
+   *  @warning This is an expert option.
+   */
+  BITWUZLA_OPT_FP_WORD_BLAST_TEMPLATES,
+
   /*! **Share partial models determined via local search with bit-blasting
    *    engine.**
    *
@@ -3151,6 +3331,33 @@ BitwuzlaResult bitwuzla_check_sat(Bitwuzla *bitwuzla);
 const BitwuzlaTerm *bitwuzla_get_value(Bitwuzla *bitwuzla,
                                        const BitwuzlaTerm *term);
 
+/**
+ * Get terms representing the model values of a given list of terms.
+ *
+ * Equivalent to calling `bitwuzla_get_value()` on each term, but the model
+ * values are computed in a single traversal of all given terms, which
+ * amortizes the cost of querying many terms that share subterms. In
+ * combination with `::BITWUZLA_OPT_FUN_LAZY_MODEL`, only the model values of
+ * the given terms and the terms below them are computed.
+ *
+ * Requires that the last `bitwuzla_check_sat()` query returned
+ * `::BITWUZLA_SAT`.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param size The number of terms in `terms`.
+ * @param terms The terms to query model values for.
+ *
+ * @return An array of terms of size `size`, where the i-th term represents
+ *         the model value of term `terms[i]`.
+ *
+ * @see
+ *   * `bitwuzla_get_value`
+ *   * `bitwuzla_check_sat`
+ */
+const BitwuzlaTerm **bitwuzla_get_values(Bitwuzla *bitwuzla,
+                                         size_t size,
+                                         const BitwuzlaTerm *terms[]);
+
 /**
  * Get string representation of the current model value of given bit-vector
  * term.
@@ -3215,6 +3422,35 @@ void bitwuzla_get_array_value(Bitwuzla *bitwuzla,
                               size_t *size,
                               const BitwuzlaTerm **default_value);
 
+/**
+ * Get the current model value of given array term in compact form.
+ *
+ * Contrary to `bitwuzla_get_array_value()`, contiguous indices that map to
+ * the same value are merged into ranges, i.e., all indices `j` with
+ * `lowers[i] <= j <= uppers[i]` (unsigned) map to `values[i]`. Ranges are
+ * sorted by their lower bound and do not overlap.
+ *
+ * @param bitwuzla The Bitwuzla instance.
+ * @param term The term to query a model value for.
+ * @param lowers List of lower bounds (inclusive) of the index ranges of size
+ *               `size`.
+ * @param uppers List of upper bounds (inclusive) of the index ranges of size
+ *               `size`.
+ * @param values List of values of size `size`.
+ * @param size Size of `lowers`, `uppers` and `values` list.
+ * @param default_value The value of all other indices not in any range and
+ *                      is set when base array is a constant array.
+ *
+ * @see bitwuzla_get_array_value
+ */
+void bitwuzla_get_array_value_ranges(Bitwuzla *bitwuzla,
+                                     const BitwuzlaTerm *term,
+                                     const BitwuzlaTerm ***lowers,
+                                     const BitwuzlaTerm ***uppers,
+                                     const BitwuzlaTerm ***values,
+                                     size_t *size,
+                                     const BitwuzlaTerm **default_value);
+
 /**
  * Get the current model value of given function term.
  *
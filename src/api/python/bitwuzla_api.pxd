@@ -304,6 +304,11 @@ cdef extern from "bitwuzla.h":
                                            const BitwuzlaTerm *term) \
         except +raise_py_error
 
+    const BitwuzlaTerm **bitwuzla_get_values(Bitwuzla *bitwuzla,
+                                             size_t size,
+                                             const BitwuzlaTerm **terms) \
+        except +raise_py_error
+
     const char *bitwuzla_get_bv_value(Bitwuzla *bitwuzla,
                                       const BitwuzlaTerm *term) \
         except +raise_py_error
@@ -327,6 +332,15 @@ cdef extern from "bitwuzla.h":
                                   const BitwuzlaTerm **default_value) \
         except +raise_py_error
 
+    void bitwuzla_get_array_value_ranges(Bitwuzla *bitwuzla,
+                                         const BitwuzlaTerm *term,
+                                         const BitwuzlaTerm ***lowers,
+                                         const BitwuzlaTerm ***uppers,
+                                         const BitwuzlaTerm ***values,
+                                         size_t *size,
+                                         const BitwuzlaTerm **default_value) \
+        except +raise_py_error
+
     void bitwuzla_get_fun_value(Bitwuzla *bitwuzla,
                                 const BitwuzlaTerm *term,
                                 const BitwuzlaTerm ****args,
@@ -695,6 +695,46 @@ cdef class Bitwuzla:
         return _to_term(self, bitwuzla_api.bitwuzla_get_value(self.ptr(),
                                                               term.ptr()))
 
+    def get_values(self, terms):
+        """get_values(terms)
+
+           Get model values of a list of terms.
+
+           Equivalent to calling :func:`~pybitwuzla.Bitwuzla.get_value` on
+           each term, but the model values are computed in a single traversal
+           that shares common subterms.
+
+           Requires that the last :func:`~pybitwuzla.Bitwuzla.check_sat` call
+           returned `~pybitwuzla.Result.SAT`.
+
+           :param terms: The terms to query model values for.
+           :type terms: list(BitwuzlaTerm)
+
+           :return: Terms representing the model values of `terms`.
+           :rtype: list(BitwuzlaTerm)
+        """
+        if not isinstance(terms, list) and not isinstance(terms, tuple):
+            raise ValueError('Expected list or tuple for terms')
+
+        num_terms = len(terms)
+        cdef const bitwuzla_api.BitwuzlaTerm **c_terms =\
+                _alloc_terms_const(num_terms)
+
+        for i in range(num_terms):
+            if not isinstance(terms[i], BitwuzlaTerm):
+                free(c_terms)
+                raise ValueError('Argument at position {} is ' \
+                                 'not of type BitwuzlaTerm'.format(i))
+            c_terms[i] = (<BitwuzlaTerm> terms[i]).ptr()
+
+        values = _to_terms(self,
+                           num_terms,
+                           bitwuzla_api.bitwuzla_get_values(self.ptr(),
+                                                            num_terms,
+                                                            c_terms))
+        free(c_terms)
+        return values
+
     def get_value_str(self, BitwuzlaTerm term):
         """get_value_str(term)
 
@@ -772,6 +812,45 @@ cdef class Bitwuzla:
             return _to_str(bitwuzla_api.bitwuzla_get_rm_value(self.ptr(),
                                                               term.ptr()))
 
+    def get_array_value_ranges(self, BitwuzlaTerm term):
+        """get_array_value_ranges(term)
+
+           Get model value of array `term` in compact form, where contiguous
+           indices that map to the same value are merged into ranges.
+
+           Requires that the last :func:`~pybitwuzla.Bitwuzla.check_sat` call
+           returned :class:`~pybitwuzla.Result.SAT`.
+
+           :return: A tuple of a list of 3-tuples (lower, upper, value) and
+                    the default value (None if the base array is not a
+                    constant array). All indices `j` with
+                    `lower <= j <= upper` (unsigned) map to `value`.
+           :rtype: tuple(list(tuple(BitwuzlaTerm, BitwuzlaTerm, BitwuzlaTerm)),
+                   BitwuzlaTerm)
+
+           .. seealso::
+               :func:`~pybitwuzla.Bitwuzla.get_value_str`
+        """
+        cdef const bitwuzla_api.BitwuzlaTerm** lowers
+        cdef const bitwuzla_api.BitwuzlaTerm** uppers
+        cdef const bitwuzla_api.BitwuzlaTerm** values
+        cdef const bitwuzla_api.BitwuzlaTerm* default_value
+        cdef size_t size
+
+        bitwuzla_api.bitwuzla_get_array_value_ranges(self.ptr(),
+                                                     term.ptr(),
+                                                     &lowers,
+                                                     &uppers,
+                                                     &values,
+                                                     &size,
+                                                     &default_value)
+        ranges = [(_to_term(self, lowers[i]),
+                   _to_term(self, uppers[i]),
+                   _to_term(self, values[i])) for i in range(size)]
+        if default_value is NULL:
+            return ranges, None
+        return ranges, _to_term(self, default_value)
+
     def get_model(self, fmt='smt2'):
         """get_model(fmt = "smt2")
 
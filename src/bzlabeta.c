@@ -750,6 +750,7 @@ beta_reduce_partial_aux(Bzla *bzla,
           {
             assert(conds_stack);
             BZLA_PUSH_STACK(*conds_stack, bzla_node_copy(bzla, tmp));
+            bzla_hashint_table_add(conds_cache, bzla_node_get_id(tmp));
           }
 
           if (t && !bzla_hashptr_table_get(t, e[0]))
@@ -882,3 +883,172 @@ bzla_beta_reduce_partial_collect_new(Bzla *bzla,
   BZLALOG(2, "%s: %s", __FUNCTION__, bzla_util_node2string(exp));
   return beta_reduce_partial_aux(bzla, exp, 0, 0, 0, exps, cache);
 }
+
+/*------------------------------------------------------------------------*/
+
+struct BzlaBetaCacheEntry
+{
+  BzlaNode *result;
+  /* conditions (w.r.t. the evaluated polarity) on the path to 'result' */
+  BzlaNodePtrStack conds;
+};
+
+typedef struct BzlaBetaCacheEntry BzlaBetaCacheEntry;
+
+BzlaBetaCache *
+bzla_beta_cache_new(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaBetaCache *res;
+
+  BZLA_CNEW(bzla->mm, res);
+  res->bzla  = bzla;
+  res->table = bzla_hashptr_table_new(bzla->mm,
+                                      (BzlaHashPtr) bzla_node_pair_hash,
+                                      (BzlaCmpPtr) bzla_node_pair_compare);
+  return res;
+}
+
+static void
+delete_beta_cache_entry(Bzla *bzla, BzlaBetaCacheEntry *entry)
+{
+  while (!BZLA_EMPTY_STACK(entry->conds))
+    bzla_node_release(bzla, BZLA_POP_STACK(entry->conds));
+  BZLA_RELEASE_STACK(entry->conds);
+  bzla_node_release(bzla, entry->result);
+  BZLA_DELETE(bzla->mm, entry);
+}
+
+void
+bzla_beta_cache_reset(BzlaBetaCache *cache)
+{
+  assert(cache);
+
+  Bzla *bzla;
+  BzlaBetaCacheEntry *entry;
+  BzlaPtrHashTableIterator it;
+
+  bzla = cache->bzla;
+  bzla_iter_hashptr_init(&it, cache->table);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    entry = it.bucket->data.as_ptr;
+    bzla_node_pair_delete(bzla, bzla_iter_hashptr_next(&it));
+    delete_beta_cache_entry(bzla, entry);
+  }
+  bzla_hashptr_table_delete(cache->table);
+  cache->table = bzla_hashptr_table_new(bzla->mm,
+                                        (BzlaHashPtr) bzla_node_pair_hash,
+                                        (BzlaCmpPtr) bzla_node_pair_compare);
+}
+
+void
+bzla_beta_cache_delete(BzlaBetaCache *cache)
+{
+  assert(cache);
+
+  bzla_beta_cache_reset(cache);
+  bzla_hashptr_table_delete(cache->table);
+  BZLA_DELETE(cache->bzla->mm, cache);
+}
+
+/* Check if all conditions recorded in 'entry' still hold under the current
+ * model. Entries of previous sat calls are invalid if the result or any of
+ * the conditions were simplified in the meantime. */
+static bool
+is_valid_beta_cache_entry(Bzla *bzla, BzlaBetaCacheEntry *entry)
+{
+  bool res;
+  uint32_t i;
+  BzlaNode *cond;
+  BzlaBitVector *bv;
+
+  if (bzla_node_is_simplified(entry->result)) return false;
+
+  for (i = 0, res = true; res && i < BZLA_COUNT_STACK(entry->conds); i++)
+  {
+    cond = BZLA_PEEK_STACK(entry->conds, i);
+    if (bzla_node_is_simplified(cond)) return false;
+    bv  = bzla_eval_exp(bzla, cond);
+    res = bzla_bv_is_true(bv);
+    bzla_bv_free(bzla->mm, bv);
+  }
+  return res;
+}
+
+BzlaNode *
+bzla_beta_reduce_partial_cached(Bzla *bzla,
+                                BzlaNode *fun,
+                                BzlaNode *args,
+                                BzlaPtrHashTable *conds,
+                                BzlaBetaCache *cache)
+{
+  assert(bzla);
+  assert(fun);
+  assert(bzla_node_is_regular(fun));
+  assert(bzla_node_is_lambda(fun));
+  assert(args);
+  assert(bzla_node_is_regular(args));
+  assert(bzla_node_is_args(args));
+  assert(cache);
+  assert(cache->bzla == bzla);
+
+  uint32_t i;
+  BzlaNode *result, *cond;
+  BzlaNodePair *pair, *key;
+  BzlaPtrHashBucket *b;
+  BzlaBetaCacheEntry *entry;
+  BzlaIntHashTable *conds_cache;
+
+  BZLALOG(2,
+          "%s: %s, %s",
+          __FUNCTION__,
+          bzla_util_node2string(fun),
+          bzla_util_node2string(args));
+
+  pair = bzla_node_pair_new(bzla, fun, args);
+  b    = bzla_hashptr_table_get(cache->table, pair);
+
+  if (b)
+  {
+    entry = b->data.as_ptr;
+    if (!bzla_node_is_simplified(fun) && !bzla_node_is_simplified(args)
+        && is_valid_beta_cache_entry(bzla, entry))
+    {
+      bzla_node_pair_delete(bzla, pair);
+      cache->stats.hits += 1;
+      if (conds)
+      {
+        for (i = 0; i < BZLA_COUNT_STACK(entry->conds); i++)
+        {
+          cond = bzla_node_real_addr(BZLA_PEEK_STACK(entry->conds, i));
+          if (!bzla_hashptr_table_get(conds, cond))
+            bzla_hashptr_table_add(conds, bzla_node_copy(bzla, cond));
+        }
+      }
+      return bzla_node_copy(bzla, entry->result);
+    }
+    /* path changed, recompute */
+    cache->stats.invalid += 1;
+    bzla_hashptr_table_remove(cache->table, pair, (void **) &key, 0);
+    bzla_node_pair_delete(bzla, key);
+    delete_beta_cache_entry(bzla, entry);
+  }
+  cache->stats.misses += 1;
+
+  BZLA_CNEW(bzla->mm, entry);
+  BZLA_INIT_STACK(bzla->mm, entry->conds);
+  conds_cache = bzla_hashint_table_new(bzla->mm);
+
+  bzla_beta_assign_args(bzla, fun, args);
+  result = beta_reduce_partial_aux(
+      bzla, fun, 0, 0, conds, &entry->conds, conds_cache);
+  bzla_beta_unassign_params(bzla, fun);
+  bzla_hashint_table_delete(conds_cache);
+
+  entry->result = bzla_node_copy(bzla, result);
+  bzla_hashptr_table_add(cache->table, pair)->data.as_ptr = entry;
+
+  return result;
+}
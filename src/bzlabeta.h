@@ -16,6 +16,37 @@
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
 
+/* Persistent cache for partial beta reduction results.
+ *
+ * Maps (function, arguments) to the result of the partial beta reduction of
+ * the function w.r.t. the arguments, and the conditions that were evaluated
+ * to derive the result. Since partial beta reduction evaluates conditions
+ * under the current model, a cached result is only reused if all recorded
+ * conditions still evaluate to the same values, i.e., entries remain valid
+ * across refinement iterations and incremental sat calls (model changes) as
+ * long as the selected paths do not change and none of the involved nodes
+ * got simplified. */
+struct BzlaBetaCache
+{
+  Bzla* bzla;
+  BzlaPtrHashTable* table;
+  struct
+  {
+    uint_least64_t hits;
+    uint_least64_t misses;
+    uint_least64_t invalid; /* entries with changed conditions */
+  } stats;
+};
+
+typedef struct BzlaBetaCache BzlaBetaCache;
+
+BzlaBetaCache* bzla_beta_cache_new(Bzla* bzla);
+
+void bzla_beta_cache_delete(BzlaBetaCache* cache);
+
+/* Remove all entries from 'cache' (and release the cached nodes). */
+void bzla_beta_cache_reset(BzlaBetaCache* cache);
+
 BzlaNode* bzla_beta_reduce_full(Bzla* bzla,
                                 BzlaNode* exp,
                                 BzlaPtrHashTable* cache);
@@ -38,6 +69,15 @@ BzlaNode* bzla_beta_reduce_partial_collect_new(Bzla* bzla,
                                                BzlaNodePtrStack* exps,
                                                BzlaIntHashTable* cache);
 
+/* Partial beta reduction of 'fun' w.r.t. 'args' (parameters are assigned and
+ * unassigned internally). Results are cached in 'cache'. Evaluated conditions
+ * are added to 'conds' (if given), as for bzla_beta_reduce_partial. */
+BzlaNode* bzla_beta_reduce_partial_cached(Bzla* bzla,
+                                          BzlaNode* fun,
+                                          BzlaNode* args,
+                                          BzlaPtrHashTable* conds,
+                                          BzlaBetaCache* cache);
+
 BzlaNode* bzla_beta_reduce_bounded(Bzla* bzla, BzlaNode* exp, int32_t bound);
 
 void bzla_beta_assign_param(Bzla* bzla, BzlaNode* lambda, BzlaNode* arg);
@@ -1010,6 +1010,7 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BzlaPtrHashTableIterator cit;
 
     chkclone_node_ptr_hash_table(slv->lemmas, cslv->lemmas, 0);
+    chkclone_int_hash_map(slv->ack_lemmas, cslv->ack_lemmas, cmp_data_as_int);
 
     if (slv->score)
     {
@@ -1045,18 +1046,26 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     {
       assert(!cslv->score);
     }
+    chkclone_int_hash_table(slv->score_visited, cslv->score_visited);
 
     assert(BZLA_COUNT_STACK(slv->stats.lemmas_size)
            == BZLA_COUNT_STACK(cslv->stats.lemmas_size));
     for (i = 0; i < BZLA_COUNT_STACK(slv->stats.lemmas_size); i++)
       assert(BZLA_PEEK_STACK(slv->stats.lemmas_size, i)
              == BZLA_PEEK_STACK(cslv->stats.lemmas_size, i));
+    assert(BZLA_COUNT_STACK(slv->stats.lemmas_per_round)
+           == BZLA_COUNT_STACK(cslv->stats.lemmas_per_round));
+    for (i = 0; i < BZLA_COUNT_STACK(slv->stats.lemmas_per_round); i++)
+      assert(BZLA_PEEK_STACK(slv->stats.lemmas_per_round, i)
+             == BZLA_PEEK_STACK(cslv->stats.lemmas_per_round, i));
 
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, lod_refinements);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, refinement_iterations);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, function_congruence_conflicts);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, beta_reduction_conflicts);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, extensionality_lemmas);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, dynamic_ack_funs);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, dynamic_ack_lemmas);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, lemmas_size_sum);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_failed_vars);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_assumed_vars);
@@ -1064,9 +1073,11 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_assumed_applies);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_failed_eqs);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_assumed_eqs);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, dp_clones);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, eval_exp_calls);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, propagations);
     BZLA_CHKCLONE_SLV_STATS(slv, cslv, propagations_down);
+    BZLA_CHKCLONE_SLV_STATS(slv, cslv, weg_lookups);
   }
   else if (bzla->slv->kind == BZLA_SLS_SOLVER_KIND)
   {
@@ -1133,6 +1144,7 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     BzlaPropSolver *cslv = BZLA_PROP_SOLVER(clone);
 
     chkclone_int_hash_map(slv->roots, cslv->roots, cmp_data_as_int);
+    chkclone_int_hash_map(slv->selected, cslv->selected, cmp_data_as_int);
     chkclone_int_hash_map(slv->score, cslv->score, cmp_data_as_dbl);
 
     BZLA_CHKCLONE_SLV_STATE(slv, cslv, flip_cond_const_prob);
@@ -1181,12 +1193,20 @@ chkclone_slv(Bzla *bzla, Bzla *clone)
     assert(slv->aprop != cslv->aprop);
     assert(slv->aprop->roots == cslv->aprop->roots);
 
-    chkclone_int_hash_map(
-        slv->aprop->unsatroots, cslv->aprop->unsatroots, cmp_data_as_int);
-    chkclone_int_hash_map(
-        slv->aprop->model, cslv->aprop->model, cmp_data_as_int);
-    chkclone_int_hash_map(
-        slv->aprop->score, cslv->aprop->score, cmp_data_as_dbl);
+    BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, nnodes);
+    BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, nids);
+    assert(BZLA_COUNT_STACK(slv->aprop->unsatroots)
+           == BZLA_COUNT_STACK(cslv->aprop->unsatroots));
+    assert(!slv->aprop->model == !cslv->aprop->model);
+    assert(!slv->aprop->model || slv->aprop->model != cslv->aprop->model);
+    assert(!slv->aprop->model
+           || !memcmp(slv->aprop->model,
+                      cslv->aprop->model,
+                      (slv->aprop->nnodes + 63) / 64 * sizeof(uint64_t)));
+    assert(!slv->aprop->pos
+           || !memcmp(slv->aprop->pos,
+                      cslv->aprop->pos,
+                      slv->aprop->nids * sizeof(uint32_t)));
 
     BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, loglevel);
     BZLA_CHKCLONE_SLV_STATE(slv->aprop, cslv->aprop, seed);
@@ -1256,6 +1256,11 @@ clone_aux_bzla(Bzla *bzla,
   assert((allocated += MEM_INT_HASH_TABLE(bzla->assertions_cache))
          == clone->mm->allocated);
 
+  clone->extract_cache =
+      bzla_hashint_table_clone(clone->mm, bzla->extract_cache);
+  assert((allocated += MEM_INT_HASH_TABLE(bzla->extract_cache))
+         == clone->mm->allocated);
+
   bzla_clone_node_ptr_stack(
       mm, &bzla->assertions, &clone->assertions, emap, false);
   assert((allocated += BZLA_SIZE_STACK(bzla->assertions) * sizeof(BzlaNode *))
@@ -1461,9 +1466,14 @@ clone_aux_bzla(Bzla *bzla,
 
       allocated += sizeof(BzlaFunSolver);
 
+      /* beta reduction cache is not cloned */
+      allocated += sizeof(BzlaBetaCache);
+      allocated += MEM_PTR_HASH_TABLE(cslv->beta_cache->table);
       allocated += MEM_PTR_HASH_TABLE(slv->lemmas);
       allocated += BZLA_SIZE_STACK(slv->cur_lemmas) * sizeof(BzlaNode *);
       allocated += BZLA_SIZE_STACK(slv->constraints) * sizeof(BzlaNode *);
+      CHKCLONE_MEM_INT_HASH_MAP(slv->ack_lemmas, cslv->ack_lemmas);
+      allocated += MEM_INT_HASH_MAP(slv->ack_lemmas);
 
       if (slv->score)
       {
@@ -1493,12 +1503,19 @@ clone_aux_bzla(Bzla *bzla,
           allocated += MEM_PTR_HASH_TABLE(slv->score);
         }
       }
+      if (slv->score_visited)
+      {
+        CHKCLONE_MEM_INT_HASH_TABLE(slv->score_visited, cslv->score_visited);
+        allocated += MEM_INT_HASH_TABLE(slv->score_visited);
+      }
 
       assert(BZLA_SIZE_STACK(slv->stats.lemmas_size)
              == BZLA_SIZE_STACK(cslv->stats.lemmas_size));
       assert(BZLA_COUNT_STACK(slv->stats.lemmas_size)
              == BZLA_COUNT_STACK(cslv->stats.lemmas_size));
       allocated += BZLA_SIZE_STACK(slv->stats.lemmas_size) * sizeof(uint32_t);
+      allocated +=
+          BZLA_SIZE_STACK(cslv->stats.lemmas_per_round) * sizeof(uint32_t);
     }
     else if (clone->slv->kind == BZLA_SLS_SOLVER_KIND)
     {
@@ -1511,6 +1528,7 @@ clone_aux_bzla(Bzla *bzla,
       CHKCLONE_MEM_INT_HASH_MAP(slv->weights, cslv->weights);
 
       allocated += sizeof(BzlaSLSSolver) + MEM_INT_HASH_MAP(cslv->roots)
+                   + BZLA_SIZE_STACK(cslv->roots_stack) * sizeof(int32_t)
                    + MEM_INT_HASH_MAP(cslv->score)
                    + MEM_INT_HASH_MAP(cslv->weights);
 
@@ -1551,10 +1569,13 @@ clone_aux_bzla(Bzla *bzla,
       BzlaPropSolver *cslv = BZLA_PROP_SOLVER(clone);
 
       CHKCLONE_MEM_INT_HASH_MAP(slv->roots, cslv->roots);
+      CHKCLONE_MEM_INT_HASH_MAP(slv->selected, cslv->selected);
       CHKCLONE_MEM_INT_HASH_MAP(slv->score, cslv->score);
 
       allocated +=
           sizeof(BzlaPropSolver) + MEM_PTR_HASH_TABLE(cslv->roots)
+          + BZLA_SIZE_STACK(cslv->roots_stack) * sizeof(int32_t)
+          + MEM_PTR_HASH_TABLE(cslv->selected)
           + MEM_PTR_HASH_TABLE(cslv->score)
 #ifndef NDEBUG
           + BZLA_SIZE_STACK(cslv->prop_path) * sizeof(BzlaPropEntailInfo);
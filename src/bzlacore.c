@@ -764,6 +764,7 @@ bzla_new(void)
   BZLA_INIT_STACK(mm, bzla->assertions);
   BZLA_INIT_STACK(mm, bzla->assertions_trail);
   bzla->assertions_cache = bzla_hashint_table_new(mm);
+  bzla->extract_cache    = bzla_hashint_table_new(mm);
 
 #ifndef NDEBUG
   bzla->stats.rw_rules_applied = bzla_hashptr_table_new(
@@ -960,6 +961,7 @@ bzla_delete(Bzla *bzla)
   BZLA_RELEASE_STACK(bzla->assertions);
   BZLA_RELEASE_STACK(bzla->assertions_trail);
   bzla_hashint_table_delete(bzla->assertions_cache);
+  bzla_hashint_table_delete(bzla->extract_cache);
 
   bzla_model_delete(bzla);
   bzla_node_release(bzla, bzla->true_exp);
@@ -2425,7 +2427,7 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
         BZLA_PUSH_STACK(exp_stack, cur);
         if (bzla_node_fp_needs_word_blast(bzla, cur))
         {
-          wb = bzla_fp_word_blast(bzla, cur);
+          wb = bzla_fp_word_blast_lazy(bzla, cur);
           BZLA_PUSH_STACK(exp_stack, wb);
         }
         for (j = 1; j <= cur->arity; j++)
@@ -2460,7 +2462,7 @@ bzla_synthesize_exp(Bzla *bzla, BzlaNode *exp, BzlaPtrHashTable *backannotation)
        * of word-blasted bit-vector node. */
       if (bzla_node_fp_needs_word_blast(bzla, cur))
       {
-        wb         = bzla_fp_word_blast(bzla, cur);
+        wb         = bzla_fp_word_blast_lazy(bzla, cur);
         invert_av0 = bzla_node_is_inverted(wb);
         av0        = bzla_aigvec_copy(avmgr, bzla_node_real_addr(wb)->av);
         if (invert_av0) bzla_aigvec_invert(avmgr, av0);
@@ -2859,6 +2861,16 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
     bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
   }
 
+  /* eliminate lambdas for the prop engine with UFs and arrays */
+  if (bzla->ufs->count > 0 && bzla->feqs->count == 0
+      && bzla->lambdas->count > 0
+      && bzla_opt_get(bzla, BZLA_OPT_ENGINE) == BZLA_ENGINE_PROP
+      && bzla_opt_get(bzla, BZLA_OPT_PROP_FUN))
+  {
+    BZLA_MSG(bzla->msg, 1, "prop engine with UFs, enable beta-reduction=all");
+    bzla_opt_set(bzla, BZLA_OPT_PP_BETA_REDUCE, BZLA_BETA_REDUCE_ALL);
+  }
+
   /* Lambdas are not supported with FP right now since we can't handle FP
    * expressions in bzla_eval_exp yet. */
   if (is_fp_logic(bzla))
@@ -2902,10 +2914,12 @@ bzla_check_sat(Bzla *bzla, int32_t lod_limit, int32_t sat_limit)
                    "Quantifiers not supported for -E sls");
         bzla->slv = bzla_new_sls_solver(bzla);
       }
-      else if (engine == BZLA_ENGINE_PROP && bzla->ufs->count == 0
-               && bzla->feqs->count == 0)
+      else if (engine == BZLA_ENGINE_PROP && bzla->feqs->count == 0
+               && (bzla->ufs->count == 0
+                   || (bzla_opt_get(bzla, BZLA_OPT_PROP_FUN)
+                       && bzla_prop_solver_supports_funs(bzla))))
       {
-        assert(bzla->lambdas->count == 0
+        assert(bzla->lambdas->count == 0 || bzla->ufs->count > 0
                || bzla_opt_get(bzla, BZLA_OPT_PP_BETA_REDUCE));
         BZLA_ABORT(bzla->quantifiers->count,
                    "Quantifiers not supported for -E prop");
@@ -102,6 +102,11 @@ struct Bzla
 
   BzlaPtrHashTable *substitutions;
 
+  /* ids of write chains (top-most store or write lambda) for which lambda
+   * extraction did not find any pattern, skipped in subsequent (incremental)
+   * calls */
+  BzlaIntHashTable *extract_cache;
+
   BzlaNode *true_exp;
 
   BzlaIntHashTable *bv_model;
@@ -57,6 +57,15 @@ compute_scores_aux_min_dep(Bzla *bzla, BzlaNodePtrStack *nodes)
       if (!d)
       {
         d = bzla_hashint_map_add(mark, cur->id);
+
+        /* score already computed in a previous round */
+        b = bzla_hashptr_table_get(score, cur);
+        if (b && b->data.as_int > 0)
+        {
+          d->as_int = 1;
+          continue;
+        }
+
         BZLA_PUSH_STACK(stack, cur);
 
         if (cur->arity == 0)
@@ -253,7 +262,6 @@ bzla_dcr_compute_scores(Bzla *bzla)
   mm    = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
   BZLA_INIT_STACK(mm, nodes);
-  mark = bzla_hashint_table_new(mm);
 
   slv = BZLA_FUN_SOLVER(bzla);
 
@@ -261,7 +269,12 @@ bzla_dcr_compute_scores(Bzla *bzla)
     slv->score = bzla_hashptr_table_new(mm,
                                         (BzlaHashPtr) bzla_node_hash_by_id,
                                         (BzlaCmpPtr) bzla_node_compare_by_id);
+  if (!slv->score_visited) slv->score_visited = bzla_hashint_table_new(mm);
+  mark = slv->score_visited;
 
+  /* scores only depend on the structure of the formula, hence only the cones
+   * of roots that were added since the last round (e.g., lemmas) have to be
+   * traversed */
   bzla_iter_hashptr_init(&it, bzla->synthesized_constraints);
   bzla_iter_hashptr_queue(&it, bzla->assumptions);
   while (bzla_iter_hashptr_has_next(&it))
@@ -289,7 +302,6 @@ bzla_dcr_compute_scores(Bzla *bzla)
   }
 
   BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(mark);
 
   compute_scores_aux(bzla, &nodes);
 
@@ -321,7 +333,6 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
   start = bzla_util_time_stamp();
   mm    = bzla->mm;
   BZLA_INIT_STACK(mm, stack);
-  mark = bzla_hashint_table_new(mm);
 
   slv = BZLA_FUN_SOLVER(bzla);
 
@@ -337,8 +348,11 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
     slv->score = bzla_hashptr_table_new(mm,
                                         (BzlaHashPtr) bzla_node_hash_by_id,
                                         (BzlaCmpPtr) bzla_node_compare_by_id);
+  if (!slv->score_visited) slv->score_visited = bzla_hashint_table_new(mm);
+  mark = slv->score_visited;
 
-  /* collect applies in bv skeleton */
+  /* collect applies in bv skeleton (of new roots only, see
+   * bzla_dcr_compute_scores) */
   bzla_iter_hashptr_init(&it, bzla->synthesized_constraints);
   bzla_iter_hashptr_queue(&it, bzla->assumptions);
   while (bzla_iter_hashptr_has_next(&it))
@@ -368,7 +382,6 @@ bzla_dcr_compute_scores_dual_prop(Bzla *bzla)
   }
 
   BZLA_RELEASE_STACK(stack);
-  bzla_hashint_table_delete(mark);
 
   /* compute scores from applies downwards */
   compute_scores_aux(bzla, &nodes);
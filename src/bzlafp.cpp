@@ -10,7 +10,9 @@
 
 #include <gmpxx.h>
 
+#include <algorithm>
 #include <sstream>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
@@ -20,9 +22,11 @@ extern "C" {
 #include "bzlacore.h"
 #include "bzlaexp.h"
 #include "bzlafp.h"
+#include "bzlamodel.h"
 #include "bzlanode.h"
 #include "bzlarm.h"
 #include "bzlasort.h"
+#include "bzlasubst.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlamem.h"
 #include "utils/bzlautil.h"
@@ -2021,17 +2025,40 @@ struct BzlaNodeHashFunction
   size_t operator()(BzlaNode *exp) const { return bzla_node_hash_by_id(exp); }
 };
 
+/* Operator kind, floating-point sort and rounding mode of a word-blasting
+ * template (BZLA_RM_MAX if the rounding mode is not constant). */
+using BzlaFPTemplateKey =
+    std::tuple<BzlaNodeKind, BzlaSortId, BzlaRoundingMode>;
+
+struct BzlaFPTemplateKeyHashFunction
+{
+  size_t operator()(const BzlaFPTemplateKey &k) const
+  {
+    return std::get<0>(k) * 333444569u + std::get<1>(k) * 76891121u
+           + std::get<2>(k) * 456790003u;
+  }
+};
+
 class BzlaFPWordBlaster
 {
  public:
   BzlaFPWordBlaster(Bzla *bzla) : d_bzla(bzla) {}
   ~BzlaFPWordBlaster();
 
-  BzlaNode *word_blast(BzlaNode *node);
-  BzlaNode *get_word_blasted_node(BzlaNode *node);
+  BzlaNode *word_blast(BzlaNode *node, bool lazy = false);
+  BzlaNode *get_word_blasted_node(BzlaNode *node, bool lazy = false);
   void get_introduced_ufs(std::vector<BzlaNode *> &ufs);
   void add_additional_assertions();
 
+  const std::vector<BzlaNode *> &get_abstractions() const
+  {
+    return d_abstractions;
+  }
+  void refine(BzlaNode *node);
+  void add_to_model(BzlaIntHashTable *bv_model,
+                    BzlaNode *node,
+                    const BzlaBitVector *value);
+
   BzlaFPWordBlaster *clone(Bzla *cbzla, BzlaNodeMap *exp_map);
 
   Bzla *get_bzla() { return d_bzla; }
@@ -2055,7 +2082,34 @@ class BzlaFPWordBlaster
   using BzlaSymUnpackedFloat   = ::symfpu::unpackedFloat<BzlaFPSymTraits>;
   using BzlaFPUnpackedFloatMap = std::
       unordered_map<BzlaNode *, BzlaSymUnpackedFloat, BzlaNodeHashFunction>;
+
+  static bool is_lazy_op(BzlaNode *node);
+  BzlaSymUnpackedFloat mk_unpacked_float_var(BzlaNode *node);
+  void add_abstraction_axioms(BzlaNode *node);
+
+  static bool is_template_op(BzlaNode *node);
+  static BzlaSymUnpackedFloat word_blast_template_op(
+      BzlaNode *node,
+      const BzlaFPSymRM &rm,
+      const std::vector<BzlaSymUnpackedFloat> &ops);
+  BzlaSymUnpackedFloat word_blast_template(BzlaNode *node);
 #endif
+
+  /**
+   * Word-blasted circuit of an operator over fresh bit-vector variables.
+   * The circuit is the concatenation of the components of the resulting
+   * unpacked float (nan, inf, zero, sign, exponent, significand), the
+   * variables stand for the rounding mode (if not constant) followed by the
+   * components of each floating-point operand. The variables never occur in
+   * any assertion and are instantiated by substitution, which saves the cost
+   * of regenerating the circuit via SymFPU but still creates a full copy of
+   * the circuit per instance.
+   */
+  struct BzlaFPTemplate
+  {
+    std::vector<BzlaNode *> d_vars;
+    BzlaNode *d_circuit;
+  };
   using BzlaFPSymRMMap =
       std::unordered_map<BzlaNode *, BzlaFPSymRM, BzlaNodeHashFunction>;
   using BzlaFPSymPropMap =
@@ -2084,6 +2138,15 @@ class BzlaFPWordBlaster
                      BzlaSortPairHashFunction>
       d_sbv_ubv_uf_map;
 
+  std::unordered_map<BzlaFPTemplateKey,
+                     BzlaFPTemplate,
+                     BzlaFPTemplateKeyHashFunction>
+      d_template_map;
+
+  /* Abstracted operator nodes that are not yet refined
+   * (BZLA_OPT_FP_LAZY_WORD_BLAST). */
+  std::vector<BzlaNode *> d_abstractions;
+
   std::unordered_map<BzlaNode *, BzlaNode *, BzlaNodeHashFunction> d_ite_map;
   std::vector<BzlaNode *> d_additional_assertions;
   Bzla *d_bzla;
@@ -2127,6 +2190,15 @@ BzlaFPWordBlaster::~BzlaFPWordBlaster()
     bzla_sort_release(d_bzla, p.first.second);
     bzla_node_release(d_bzla, p.second);
   }
+  for (const auto &p : d_template_map)
+  {
+    bzla_sort_release(d_bzla, std::get<1>(p.first));
+    for (BzlaNode *var : p.second.d_vars)
+    {
+      bzla_node_release(d_bzla, var);
+    }
+    bzla_node_release(d_bzla, p.second.d_circuit);
+  }
   for (const auto &p : d_ite_map)
   {
     bzla_node_release(d_bzla, p.first);
@@ -2154,6 +2226,10 @@ BzlaFPWordBlaster::~BzlaFPWordBlaster()
   {
     bzla_node_release(d_bzla, p.first);
   }
+  for (BzlaNode *node : d_abstractions)
+  {
+    bzla_node_release(d_bzla, node);
+  }
   for (BzlaNode *node : d_additional_assertions)
   {
     bzla_node_release(d_bzla, node);
@@ -2161,7 +2237,7 @@ BzlaFPWordBlaster::~BzlaFPWordBlaster()
 }
 
 BzlaNode *
-BzlaFPWordBlaster::word_blast(BzlaNode *node)
+BzlaFPWordBlaster::word_blast(BzlaNode *node, bool lazy)
 {
   assert(d_bzla);
   assert(node);
@@ -2177,6 +2253,15 @@ BzlaFPWordBlaster::word_blast(BzlaNode *node)
 #ifdef BZLA_USE_SYMFPU
   BzlaNode *cur;
   std::vector<BzlaNode *> to_visit;
+
+  /* abstractions are only refined by the fun engine, on models of the SAT
+   * solver (not on models found by local search or the dual prop clone) */
+  lazy = lazy && bzla_opt_get(d_bzla, BZLA_OPT_FP_LAZY_WORD_BLAST)
+         && bzla_opt_get(d_bzla, BZLA_OPT_ENGINE) == BZLA_ENGINE_FUN
+         && !bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREPROP)
+         && !bzla_opt_get(d_bzla, BZLA_OPT_FUN_PRESLS)
+         && !bzla_opt_get(d_bzla, BZLA_OPT_FUN_PREFPLS)
+         && !bzla_opt_get(d_bzla, BZLA_OPT_FUN_DUAL_PROP);
   std::unordered_map<BzlaNode *, uint32_t, BzlaNodeHashFunction> visited;
 
   to_visit.push_back(node);
@@ -2272,40 +2357,8 @@ BzlaFPWordBlaster::word_blast(BzlaNode *node)
       else if (bzla_node_is_fp_var(cur)
                || (bzla_node_is_apply(cur) && bzla_node_is_fp(d_bzla, cur)))
       {
-        BzlaSortId sort   = bzla_node_get_sort_id(cur);
-        BzlaSortId sort_1 = bzla_sort_bv(d_bzla, 1);
-        BzlaSortId sort_exp =
-            bzla_sort_bv(d_bzla, BzlaSymUnpackedFloat::exponentWidth(sort));
-        BzlaSortId sort_sig =
-            bzla_sort_bv(d_bzla, BzlaSymUnpackedFloat::significandWidth(sort));
-
-        BzlaNode *inf = bzla_exp_var(
-            d_bzla, sort_1, create_component_symbol(cur, "inf").c_str());
-        BzlaNode *nan = bzla_exp_var(
-            d_bzla, sort_1, create_component_symbol(cur, "nan").c_str());
-        BzlaNode *sign = bzla_exp_var(
-            d_bzla, sort_1, create_component_symbol(cur, "sign").c_str());
-        BzlaNode *zero = bzla_exp_var(
-            d_bzla, sort_1, create_component_symbol(cur, "zero").c_str());
-        BzlaNode *exp = bzla_exp_var(
-            d_bzla, sort_exp, create_component_symbol(cur, "exp").c_str());
-        BzlaNode *sig = bzla_exp_var(
-            d_bzla, sort_sig, create_component_symbol(cur, "sig").c_str());
-
-        BzlaSymUnpackedFloat uf(nan, inf, zero, sign, exp, sig);
-        d_unpacked_float_map.emplace(bzla_node_copy(d_bzla, cur), uf);
-        d_additional_assertions.push_back(
-            bzla_node_copy(d_bzla, uf.valid(sort).getNode()));
-
-        bzla_node_release(d_bzla, sig);
-        bzla_node_release(d_bzla, exp);
-        bzla_node_release(d_bzla, zero);
-        bzla_node_release(d_bzla, sign);
-        bzla_node_release(d_bzla, nan);
-        bzla_node_release(d_bzla, inf);
-        bzla_sort_release(d_bzla, sort_sig);
-        bzla_sort_release(d_bzla, sort_exp);
-        bzla_sort_release(d_bzla, sort_1);
+        d_unpacked_float_map.emplace(bzla_node_copy(d_bzla, cur),
+                                     mk_unpacked_float_var(cur));
       }
       else if (bzla_node_is_fp_eq(cur))
       {
@@ -2472,6 +2525,13 @@ BzlaFPWordBlaster::word_blast(BzlaNode *node)
         bzla_node_release(d_bzla, apply);
         bzla_node_release(d_bzla, apply_args);
       }
+      else if (lazy && is_lazy_op(cur))
+      {
+        d_unpacked_float_map.emplace(bzla_node_copy(d_bzla, cur),
+                                     mk_unpacked_float_var(cur));
+        d_abstractions.push_back(bzla_node_copy(d_bzla, cur));
+        add_abstraction_axioms(cur);
+      }
       else if (bzla_node_is_fp_rem(cur))
       {
         assert(d_unpacked_float_map.find(cur->e[0])
@@ -2484,6 +2544,12 @@ BzlaFPWordBlaster::word_blast(BzlaNode *node)
                                          d_unpacked_float_map.at(cur->e[0]),
                                          d_unpacked_float_map.at(cur->e[1])));
       }
+      else if (is_template_op(cur)
+               && bzla_opt_get(d_bzla, BZLA_OPT_FP_WORD_BLAST_TEMPLATES))
+      {
+        d_unpacked_float_map.emplace(bzla_node_copy(d_bzla, cur),
+                                     word_blast_template(cur));
+      }
       else if (bzla_node_is_fp_sqrt(cur))
       {
         assert(d_rm_map.find(cur->e[0]) != d_rm_map.end());
@@ -2680,12 +2746,348 @@ BzlaFPWordBlaster::word_blast(BzlaNode *node)
   assert(res);
 #else
   (void) node;
+  (void) lazy;
 #endif
   return res;
 }
 
+#ifdef BZLA_USE_SYMFPU
+BzlaFPWordBlaster::BzlaSymUnpackedFloat
+BzlaFPWordBlaster::mk_unpacked_float_var(BzlaNode *node)
+{
+  BzlaSortId sort   = bzla_node_get_sort_id(node);
+  BzlaSortId sort_1 = bzla_sort_bv(d_bzla, 1);
+  BzlaSortId sort_exp =
+      bzla_sort_bv(d_bzla, BzlaSymUnpackedFloat::exponentWidth(sort));
+  BzlaSortId sort_sig =
+      bzla_sort_bv(d_bzla, BzlaSymUnpackedFloat::significandWidth(sort));
+
+  BzlaNode *inf = bzla_exp_var(
+      d_bzla, sort_1, create_component_symbol(node, "inf").c_str());
+  BzlaNode *nan = bzla_exp_var(
+      d_bzla, sort_1, create_component_symbol(node, "nan").c_str());
+  BzlaNode *sign = bzla_exp_var(
+      d_bzla, sort_1, create_component_symbol(node, "sign").c_str());
+  BzlaNode *zero = bzla_exp_var(
+      d_bzla, sort_1, create_component_symbol(node, "zero").c_str());
+  BzlaNode *exp = bzla_exp_var(
+      d_bzla, sort_exp, create_component_symbol(node, "exp").c_str());
+  BzlaNode *sig = bzla_exp_var(
+      d_bzla, sort_sig, create_component_symbol(node, "sig").c_str());
+
+  BzlaSymUnpackedFloat uf(nan, inf, zero, sign, exp, sig);
+  d_additional_assertions.push_back(
+      bzla_node_copy(d_bzla, uf.valid(sort).getNode()));
+
+  bzla_node_release(d_bzla, sig);
+  bzla_node_release(d_bzla, exp);
+  bzla_node_release(d_bzla, zero);
+  bzla_node_release(d_bzla, sign);
+  bzla_node_release(d_bzla, nan);
+  bzla_node_release(d_bzla, inf);
+  bzla_sort_release(d_bzla, sort_sig);
+  bzla_sort_release(d_bzla, sort_exp);
+  bzla_sort_release(d_bzla, sort_1);
+  return uf;
+}
+
+bool
+BzlaFPWordBlaster::is_lazy_op(BzlaNode *node)
+{
+  return bzla_node_is_fp_div(node) || bzla_node_is_fp_sqrt(node)
+         || bzla_node_is_fp_rem(node) || bzla_node_is_fp_fma(node);
+}
+
+void
+BzlaFPWordBlaster::add_abstraction_axioms(BzlaNode *node)
+{
+  assert(is_lazy_op(node));
+  assert(d_unpacked_float_map.find(node) != d_unpacked_float_map.end());
+
+  /* nodes to release, axioms are implications premise -> conclusion */
+  std::vector<BzlaNode *> nodes;
+  std::vector<std::pair<BzlaNode *, BzlaNode *>> axioms;
+
+  const BzlaSymUnpackedFloat &r = d_unpacked_float_map.at(node);
+  BzlaNode *r_nan  = r.getNaN().getNode();
+  BzlaNode *r_inf  = r.getInf().getNode();
+  BzlaNode *r_zero = r.getZero().getNode();
+  BzlaNode *r_sign = r.getSign().getNode();
+
+  /* fp.rem has no rounding mode */
+  uint32_t first = bzla_node_is_fp_rem(node) ? 0 : 1;
+  BzlaNode *nan[3], *inf[3], *zero[3], *sign[3];
+  for (uint32_t i = first; i < node->arity; ++i)
+  {
+    assert(d_unpacked_float_map.find(node->e[i])
+           != d_unpacked_float_map.end());
+    const BzlaSymUnpackedFloat &op = d_unpacked_float_map.at(node->e[i]);
+    nan[i - first]  = op.getNaN().getNode();
+    inf[i - first]  = op.getInf().getNode();
+    zero[i - first] = op.getZero().getNode();
+    sign[i - first] = op.getSign().getNode();
+  }
+  uint32_t n = node->arity - first;
+
+  /* NaN operands yield NaN */
+  BzlaNode *any_nan = bzla_node_copy(d_bzla, nan[0]);
+  for (uint32_t i = 1; i < n; ++i)
+  {
+    BzlaNode *tmp = bzla_exp_bv_or(d_bzla, any_nan, nan[i]);
+    bzla_node_release(d_bzla, any_nan);
+    any_nan = tmp;
+  }
+  nodes.push_back(any_nan);
+  axioms.emplace_back(any_nan, r_nan);
+
+  if (bzla_node_is_fp_div(node))
+  {
+    /* sign of non-NaN results is the xor of the operand signs */
+    BzlaNode *xsign = bzla_exp_bv_xor(d_bzla, sign[0], sign[1]);
+    BzlaNode *eq    = bzla_exp_eq(d_bzla, r_sign, xsign);
+    nodes.push_back(xsign);
+    nodes.push_back(eq);
+    axioms.emplace_back(bzla_node_invert(r_nan), eq);
+    /* 0 / 0 and inf / inf are NaN */
+    BzlaNode *zz = bzla_exp_bv_and(d_bzla, zero[0], zero[1]);
+    BzlaNode *ii = bzla_exp_bv_and(d_bzla, inf[0], inf[1]);
+    nodes.push_back(zz);
+    nodes.push_back(ii);
+    axioms.emplace_back(zz, r_nan);
+    axioms.emplace_back(ii, r_nan);
+    /* x / 0 and inf / y are inf, 0 / y and x / inf are zero
+     * (x, y not zero, inf or NaN) */
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+      BzlaNode *special = bzla_exp_bv_or(d_bzla, nan[1 - i], zero[1 - i]);
+      BzlaNode *tmp     = bzla_exp_bv_or(d_bzla, special, inf[1 - i]);
+      BzlaNode *zprem =
+          bzla_exp_bv_and(d_bzla, zero[i], bzla_node_invert(tmp));
+      BzlaNode *iprem =
+          bzla_exp_bv_and(d_bzla, inf[i], bzla_node_invert(tmp));
+      nodes.push_back(special);
+      nodes.push_back(tmp);
+      nodes.push_back(zprem);
+      nodes.push_back(iprem);
+      axioms.emplace_back(zprem, i == 0 ? r_zero : r_inf);
+      axioms.emplace_back(iprem, i == 0 ? r_inf : r_zero);
+    }
+  }
+  else if (bzla_node_is_fp_sqrt(node))
+  {
+    /* sign of non-NaN results is the sign of the operand */
+    BzlaNode *eq = bzla_exp_eq(d_bzla, r_sign, sign[0]);
+    nodes.push_back(eq);
+    axioms.emplace_back(bzla_node_invert(r_nan), eq);
+    /* negative non-zero operands yield NaN */
+    BzlaNode *nz  = bzla_exp_bv_or(d_bzla, zero[0], nan[0]);
+    BzlaNode *neg = bzla_exp_bv_and(d_bzla, sign[0], bzla_node_invert(nz));
+    nodes.push_back(nz);
+    nodes.push_back(neg);
+    axioms.emplace_back(neg, r_nan);
+    /* sqrt(+-0) = +-0, sqrt(+inf) = +inf */
+    BzlaNode *pinf = bzla_exp_bv_and(d_bzla, inf[0], bzla_node_invert(sign[0]));
+    nodes.push_back(pinf);
+    axioms.emplace_back(zero[0], r_zero);
+    axioms.emplace_back(pinf, r_inf);
+  }
+  else if (bzla_node_is_fp_rem(node))
+  {
+    /* rem(inf, y) and rem(x, 0) are NaN */
+    BzlaNode *prem = bzla_exp_bv_or(d_bzla, inf[0], zero[1]);
+    nodes.push_back(prem);
+    axioms.emplace_back(prem, r_nan);
+    /* rem(0, y) is zero (y not zero or NaN) */
+    BzlaNode *nz   = bzla_exp_bv_or(d_bzla, zero[1], nan[1]);
+    BzlaNode *zrem = bzla_exp_bv_and(d_bzla, zero[0], bzla_node_invert(nz));
+    nodes.push_back(nz);
+    nodes.push_back(zrem);
+    axioms.emplace_back(zrem, r_zero);
+  }
+  else
+  {
+    assert(bzla_node_is_fp_fma(node));
+    /* inf * 0 + z and 0 * inf + z are NaN */
+    BzlaNode *iz = bzla_exp_bv_and(d_bzla, inf[0], zero[1]);
+    BzlaNode *zi = bzla_exp_bv_and(d_bzla, zero[0], inf[1]);
+    nodes.push_back(iz);
+    nodes.push_back(zi);
+    axioms.emplace_back(iz, r_nan);
+    axioms.emplace_back(zi, r_nan);
+  }
+
+  for (const auto &p : axioms)
+  {
+    d_additional_assertions.push_back(
+        bzla_exp_implies(d_bzla, p.first, p.second));
+  }
+  for (BzlaNode *n : nodes)
+  {
+    bzla_node_release(d_bzla, n);
+  }
+}
+
+bool
+BzlaFPWordBlaster::is_template_op(BzlaNode *node)
+{
+  return bzla_node_is_fp_add(node) || bzla_node_is_fp_mul(node)
+         || bzla_node_is_fp_div(node) || bzla_node_is_fp_fma(node)
+         || bzla_node_is_fp_sqrt(node);
+}
+
+BzlaFPWordBlaster::BzlaSymUnpackedFloat
+BzlaFPWordBlaster::word_blast_template_op(
+    BzlaNode *node,
+    const BzlaFPSymRM &rm,
+    const std::vector<BzlaSymUnpackedFloat> &ops)
+{
+  BzlaSortId sort = bzla_node_get_sort_id(node);
+  if (bzla_node_is_fp_add(node))
+  {
+    return symfpu::add<BzlaFPSymTraits>(
+        sort, rm, ops[0], ops[1], BzlaFPSymProp(true));
+  }
+  if (bzla_node_is_fp_mul(node))
+  {
+    return symfpu::multiply<BzlaFPSymTraits>(sort, rm, ops[0], ops[1]);
+  }
+  if (bzla_node_is_fp_div(node))
+  {
+    return symfpu::divide<BzlaFPSymTraits>(sort, rm, ops[0], ops[1]);
+  }
+  if (bzla_node_is_fp_fma(node))
+  {
+    return symfpu::fma<BzlaFPSymTraits>(sort, rm, ops[0], ops[1], ops[2]);
+  }
+  assert(bzla_node_is_fp_sqrt(node));
+  return symfpu::sqrt<BzlaFPSymTraits>(sort, rm, ops[0]);
+}
+
+BzlaFPWordBlaster::BzlaSymUnpackedFloat
+BzlaFPWordBlaster::word_blast_template(BzlaNode *node)
+{
+  assert(is_template_op(node));
+  assert(d_rm_map.find(node->e[0]) != d_rm_map.end());
+
+  BzlaSortId sort = bzla_node_get_sort_id(node);
+  uint32_t ew     = BzlaSymUnpackedFloat::exponentWidth(sort);
+  uint32_t sw     = BzlaSymUnpackedFloat::significandWidth(sort);
+
+  BzlaRoundingMode rm = bzla_node_is_rm_const(node->e[0])
+                            ? bzla_node_rm_const_get_rm(node->e[0])
+                            : BZLA_RM_MAX;
+  BzlaFPTemplateKey key(node->kind, sort, rm);
+
+  auto it = d_template_map.find(key);
+  if (it == d_template_map.end())
+  {
+    BzlaFPTemplate t;
+    std::vector<BzlaSymUnpackedFloat> ops;
+    BzlaNode *var       = nullptr;
+    BzlaSortId sort_1   = bzla_sort_bv(d_bzla, 1);
+    BzlaSortId sort_exp = bzla_sort_bv(d_bzla, ew);
+    BzlaSortId sort_sig = bzla_sort_bv(d_bzla, sw);
+
+    if (rm == BZLA_RM_MAX)
+    {
+      BzlaSortId sort_rm = bzla_sort_bv(d_bzla, BZLA_RM_BW);
+      var                = bzla_exp_var(d_bzla, sort_rm, 0);
+      t.d_vars.push_back(var);
+      bzla_sort_release(d_bzla, sort_rm);
+    }
+    BzlaFPSymRM srm(rm == BZLA_RM_MAX ? var : node->e[0]);
+
+    for (uint32_t i = 1; i < node->arity; ++i)
+    {
+      size_t n = t.d_vars.size();
+      for (uint32_t j = 0; j < 4; ++j)
+      {
+        t.d_vars.push_back(bzla_exp_var(d_bzla, sort_1, 0));
+      }
+      t.d_vars.push_back(bzla_exp_var(d_bzla, sort_exp, 0));
+      t.d_vars.push_back(bzla_exp_var(d_bzla, sort_sig, 0));
+      ops.emplace_back(t.d_vars[n],
+                       t.d_vars[n + 1],
+                       t.d_vars[n + 2],
+                       t.d_vars[n + 3],
+                       t.d_vars[n + 4],
+                       t.d_vars[n + 5]);
+    }
+
+    BzlaSymUnpackedFloat res = word_blast_template_op(node, srm, ops);
+
+    BzlaNode *components[6] = {res.getNaN().getNode(),
+                               res.getInf().getNode(),
+                               res.getZero().getNode(),
+                               res.getSign().getNode(),
+                               res.getExponent().getNode(),
+                               res.getSignificand().getNode()};
+    t.d_circuit = bzla_node_copy(d_bzla, components[5]);
+    for (uint32_t i = 5; i > 0; --i)
+    {
+      BzlaNode *tmp =
+          bzla_exp_bv_concat(d_bzla, components[i - 1], t.d_circuit);
+      bzla_node_release(d_bzla, t.d_circuit);
+      t.d_circuit = tmp;
+    }
+
+    bzla_sort_release(d_bzla, sort_sig);
+    bzla_sort_release(d_bzla, sort_exp);
+    bzla_sort_release(d_bzla, sort_1);
+    it = d_template_map
+             .emplace(BzlaFPTemplateKey(
+                          node->kind, bzla_sort_copy(d_bzla, sort), rm),
+                      t)
+             .first;
+  }
+
+  /* instantiate template with the rounding mode and the components of the
+   * word-blasted operands */
+  const BzlaFPTemplate &t = it->second;
+  BzlaNodeMap *map        = bzla_nodemap_new(d_bzla);
+  size_t n                = 0;
+  if (rm == BZLA_RM_MAX)
+  {
+    bzla_nodemap_map(map, t.d_vars[n++], d_rm_map.at(node->e[0]).getNode());
+  }
+  for (uint32_t i = 1; i < node->arity; ++i)
+  {
+    assert(d_unpacked_float_map.find(node->e[i])
+           != d_unpacked_float_map.end());
+    const BzlaSymUnpackedFloat &op = d_unpacked_float_map.at(node->e[i]);
+    bzla_nodemap_map(map, t.d_vars[n++], op.getNaN().getNode());
+    bzla_nodemap_map(map, t.d_vars[n++], op.getInf().getNode());
+    bzla_nodemap_map(map, t.d_vars[n++], op.getZero().getNode());
+    bzla_nodemap_map(map, t.d_vars[n++], op.getSign().getNode());
+    bzla_nodemap_map(map, t.d_vars[n++], op.getExponent().getNode());
+    bzla_nodemap_map(map, t.d_vars[n++], op.getSignificand().getNode());
+  }
+  assert(n == t.d_vars.size());
+  BzlaNode *circuit = bzla_substitute_nodes(d_bzla, t.d_circuit, map);
+  bzla_nodemap_delete(map);
+
+  BzlaNode *nan  = bzla_exp_bv_slice(d_bzla, circuit, ew + sw + 3, ew + sw + 3);
+  BzlaNode *inf  = bzla_exp_bv_slice(d_bzla, circuit, ew + sw + 2, ew + sw + 2);
+  BzlaNode *zero = bzla_exp_bv_slice(d_bzla, circuit, ew + sw + 1, ew + sw + 1);
+  BzlaNode *sign = bzla_exp_bv_slice(d_bzla, circuit, ew + sw, ew + sw);
+  BzlaNode *exp  = bzla_exp_bv_slice(d_bzla, circuit, ew + sw - 1, sw);
+  BzlaNode *sig  = bzla_exp_bv_slice(d_bzla, circuit, sw - 1, 0);
+
+  BzlaSymUnpackedFloat res(nan, inf, zero, sign, exp, sig);
+
+  bzla_node_release(d_bzla, sig);
+  bzla_node_release(d_bzla, exp);
+  bzla_node_release(d_bzla, sign);
+  bzla_node_release(d_bzla, zero);
+  bzla_node_release(d_bzla, inf);
+  bzla_node_release(d_bzla, nan);
+  bzla_node_release(d_bzla, circuit);
+  return res;
+}
+#endif
+
 BzlaNode *
-BzlaFPWordBlaster::get_word_blasted_node(BzlaNode *node)
+BzlaFPWordBlaster::get_word_blasted_node(BzlaNode *node, bool lazy)
 {
   assert(d_bzla);
   assert(node);
@@ -2717,9 +3119,10 @@ BzlaFPWordBlaster::get_word_blasted_node(BzlaNode *node)
     return d_packed_float_map.at(node).getNode();
   }
 
-  return word_blast(node);
+  return word_blast(node, lazy);
 #else
   (void) node;
+  (void) lazy;
   return nullptr;
 #endif
 }
@@ -2748,6 +3151,143 @@ BzlaFPWordBlaster::add_additional_assertions()
   d_additional_assertions.clear();
 }
 
+void
+BzlaFPWordBlaster::refine(BzlaNode *node)
+{
+  assert(d_bzla);
+  assert(node);
+  assert(bzla_node_is_regular(node));
+
+#ifdef BZLA_USE_SYMFPU
+  auto it = std::find(d_abstractions.begin(), d_abstractions.end(), node);
+  assert(it != d_abstractions.end());
+  d_abstractions.erase(it);
+
+  BzlaSortId sort = bzla_node_get_sort_id(node);
+  std::vector<BzlaSymUnpackedFloat> ops;
+  for (uint32_t i = bzla_node_is_fp_rem(node) ? 0 : 1; i < node->arity; ++i)
+  {
+    assert(d_unpacked_float_map.find(node->e[i])
+           != d_unpacked_float_map.end());
+    ops.push_back(d_unpacked_float_map.at(node->e[i]));
+  }
+
+  BzlaSymUnpackedFloat wb =
+      bzla_node_is_fp_rem(node)
+          ? symfpu::remainder<BzlaFPSymTraits>(sort, ops[0], ops[1])
+          : (bzla_opt_get(d_bzla, BZLA_OPT_FP_WORD_BLAST_TEMPLATES)
+                 ? word_blast_template(node)
+                 : word_blast_template_op(
+                     node, d_rm_map.at(node->e[0]), ops));
+
+  /* the abstraction equals the word-blasted operator, asserted permanently
+   * with the next call to add_additional_assertions() */
+  const BzlaSymUnpackedFloat &abs = d_unpacked_float_map.at(node);
+  BzlaNode *eqs[6] = {
+      bzla_exp_eq(d_bzla, abs.getNaN().getNode(), wb.getNaN().getNode()),
+      bzla_exp_eq(d_bzla, abs.getInf().getNode(), wb.getInf().getNode()),
+      bzla_exp_eq(d_bzla, abs.getZero().getNode(), wb.getZero().getNode()),
+      bzla_exp_eq(d_bzla, abs.getSign().getNode(), wb.getSign().getNode()),
+      bzla_exp_eq(
+          d_bzla, abs.getExponent().getNode(), wb.getExponent().getNode()),
+      bzla_exp_eq(d_bzla,
+                  abs.getSignificand().getNode(),
+                  wb.getSignificand().getNode())};
+  for (uint32_t i = 0; i < 6; ++i)
+  {
+    d_additional_assertions.push_back(eqs[i]);
+  }
+  bzla_node_release(d_bzla, node);
+#else
+  (void) node;
+#endif
+}
+
+#ifdef BZLA_USE_SYMFPU
+/* Add 'value' as model value of the variable a word-blasted component
+ * 'node' simplifies to. Components that were simplified to other terms get
+ * their model value via these terms. */
+static void
+add_component_to_model(Bzla *bzla,
+                       BzlaIntHashTable *bv_model,
+                       BzlaNode *node,
+                       const BzlaBitVector *value)
+{
+  BzlaNode *real_node;
+  BzlaBitVector *bv;
+
+  node      = bzla_node_get_simplified(bzla, node);
+  real_node = bzla_node_real_addr(node);
+  if (!bzla_node_is_bv_var(real_node)
+      || bzla_hashint_map_contains(bv_model, real_node->id))
+  {
+    return;
+  }
+  bv = bzla_node_is_inverted(node) ? bzla_bv_not(bzla->mm, value)
+                                   : bzla_bv_copy(bzla->mm, value);
+  bzla_model_add_to_bv(bzla, bv_model, real_node, bv);
+  bzla_bv_free(bzla->mm, bv);
+}
+#endif
+
+void
+BzlaFPWordBlaster::add_to_model(BzlaIntHashTable *bv_model,
+                                BzlaNode *node,
+                                const BzlaBitVector *value)
+{
+  assert(d_bzla);
+  assert(bv_model);
+  assert(node);
+  assert(bzla_node_is_regular(node));
+  assert(bzla_node_is_fp_var(node) || bzla_node_is_rm_var(node));
+  assert(value);
+
+#ifdef BZLA_USE_SYMFPU
+  /* for inputs, this only creates the component variables */
+  (void) get_word_blasted_node(node);
+
+  if (bzla_node_is_rm(d_bzla, node))
+  {
+    assert(d_rm_map.find(node) != d_rm_map.end());
+    add_component_to_model(
+        d_bzla, bv_model, d_rm_map.at(node).getNode(), value);
+    return;
+  }
+
+  assert(d_unpacked_float_map.find(node) != d_unpacked_float_map.end());
+  const BzlaSymUnpackedFloat &uf = d_unpacked_float_map.at(node);
+  BzlaFloatingPoint *fp =
+      bzla_fp_from_bv(d_bzla, bzla_node_get_sort_id(node), value);
+  BzlaUnpackedFloat *val = fp->fp;
+  BzlaMemMgr *mm         = d_bzla->mm;
+  BzlaBitVector *props[4];
+  props[0] = val->getNaN() ? bzla_bv_one(mm, 1) : bzla_bv_new(mm, 1);
+  props[1] = val->getInf() ? bzla_bv_one(mm, 1) : bzla_bv_new(mm, 1);
+  props[2] = val->getZero() ? bzla_bv_one(mm, 1) : bzla_bv_new(mm, 1);
+  props[3] = val->getSign() ? bzla_bv_one(mm, 1) : bzla_bv_new(mm, 1);
+  add_component_to_model(d_bzla, bv_model, uf.getNaN().getNode(), props[0]);
+  add_component_to_model(d_bzla, bv_model, uf.getInf().getNode(), props[1]);
+  add_component_to_model(d_bzla, bv_model, uf.getZero().getNode(), props[2]);
+  add_component_to_model(d_bzla, bv_model, uf.getSign().getNode(), props[3]);
+  add_component_to_model(d_bzla,
+                         bv_model,
+                         uf.getExponent().getNode(),
+                         val->getExponent().getBv());
+  add_component_to_model(d_bzla,
+                         bv_model,
+                         uf.getSignificand().getNode(),
+                         val->getSignificand().getBv());
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    bzla_bv_free(mm, props[i]);
+  }
+  bzla_fp_free(d_bzla, fp);
+#else
+  (void) bv_model;
+  (void) value;
+#endif
+}
+
 BzlaFPWordBlaster *
 BzlaFPWordBlaster::clone(Bzla *cbzla, BzlaNodeMap *exp_map)
 {
@@ -2825,6 +3365,24 @@ BzlaFPWordBlaster::clone(Bzla *cbzla, BzlaNodeMap *exp_map)
     assert(scexp);
     res->d_ubv_map.emplace(cexp, BzlaFPSymBV<false>(scexp));
   }
+  for (const auto &p : d_template_map)
+  {
+    /* sort references are cloned with the sorts unique table */
+    assert(res->d_template_map.find(p.first) == res->d_template_map.end());
+
+    BzlaFPTemplate t;
+    for (BzlaNode *var : p.second.d_vars)
+    {
+      cexp = bzla_nodemap_mapped(exp_map, var);
+      assert(cexp);
+      t.d_vars.push_back(cexp);
+    }
+    exp  = bzla_node_real_addr(p.second.d_circuit);
+    cexp = bzla_nodemap_mapped(exp_map, exp);
+    assert(cexp);
+    t.d_circuit = bzla_node_cond_invert(p.second.d_circuit, cexp);
+    res->d_template_map.emplace(p.first, t);
+  }
 #ifdef BZLA_USE_SYMFPU
   for (const auto &p : d_unpacked_float_map)
   {
@@ -2875,6 +3433,12 @@ BzlaFPWordBlaster::clone(Bzla *cbzla, BzlaNodeMap *exp_map)
                              BzlaFPSymBV<false>(csig)));
   }
 #endif
+  for (BzlaNode *node : d_abstractions)
+  {
+    cexp = bzla_nodemap_mapped(exp_map, node);
+    assert(cexp);
+    res->d_abstractions.push_back(cexp);
+  }
   for (BzlaNode *node : d_additional_assertions)
   {
     BzlaNode *real_node = bzla_node_real_addr(node);
@@ -4190,6 +4754,30 @@ bzla_fp_word_blaster_get_introduced_ufs(Bzla *bzla, BzlaNodePtrStack *ufs)
   }
 }
 
+void
+bzla_fp_word_blaster_get_abstractions(Bzla *bzla, BzlaNodePtrStack *nodes)
+{
+  assert(bzla);
+  if (!bzla->word_blaster) return;
+  BzlaFPWordBlaster *word_blaster =
+      static_cast<BzlaFPWordBlaster *>(bzla->word_blaster);
+
+  for (BzlaNode *node : word_blaster->get_abstractions())
+  {
+    BZLA_PUSH_STACK(*nodes, node);
+  }
+}
+
+void
+bzla_fp_word_blaster_refine(Bzla *bzla, BzlaNode *node)
+{
+  assert(bzla);
+  assert(bzla->word_blaster);
+  assert(node);
+  BzlaFPWordBlaster::set_s_bzla(bzla);
+  static_cast<BzlaFPWordBlaster *>(bzla->word_blaster)->refine(node);
+}
+
 /* ========================================================================== */
 
 void *
@@ -4243,4 +4831,32 @@ bzla_fp_word_blast(Bzla *bzla, BzlaNode *node)
   return bzla_simplify_exp(bzla, res);
 }
 
+void
+bzla_fp_word_blaster_add_to_model(Bzla *bzla,
+                                  BzlaIntHashTable *bv_model,
+                                  BzlaNode *node,
+                                  const BzlaBitVector *value)
+{
+  assert(bzla);
+  assert(bzla->word_blaster);
+  assert(bv_model);
+  assert(node);
+  assert(value);
+  BzlaFPWordBlaster::set_s_bzla(bzla);
+  static_cast<BzlaFPWordBlaster *>(bzla->word_blaster)
+      ->add_to_model(bv_model, node, value);
+}
+
+BzlaNode *
+bzla_fp_word_blast_lazy(Bzla *bzla, BzlaNode *node)
+{
+  assert(bzla);
+  assert(bzla->word_blaster);
+  assert(node);
+  BzlaFPWordBlaster::set_s_bzla(bzla);
+  BzlaNode *res = static_cast<BzlaFPWordBlaster *>(bzla->word_blaster)
+                      ->get_word_blasted_node(node, true);
+  return bzla_simplify_exp(bzla, res);
+}
+
 /* -------------------------------------------------------------------------- */
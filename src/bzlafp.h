@@ -11,6 +11,7 @@
 #include "bzlabv.h"
 #include "bzlarm.h"
 #include "bzlasort.h"
+#include "utils/bzlahashint.h"
 #include "utils/bzlanodemap.h"
 
 #ifndef BZLAFP_H_INCLUDED
@@ -333,4 +334,33 @@ BzlaNode *bzla_fp_word_blast(Bzla *bzla, BzlaNode *node);
 
 /** Return all uninterpreted functions introduced while word-blasting. */
 void bzla_fp_word_blaster_get_introduced_ufs(Bzla *bzla, BzlaNodePtrStack *ufs);
+
+/**
+ * Add the components of the word-blasted representation of floating-point or
+ * rounding mode input 'node' with model value 'value' to 'bv_model'.
+ * The input is word-blasted if necessary, which only introduces variables
+ * for its components.
+ */
+void bzla_fp_word_blaster_add_to_model(Bzla *bzla,
+                                       BzlaIntHashTable *bv_model,
+                                       BzlaNode *node,
+                                       const BzlaBitVector *value);
+
+/**
+ * Word-blast given floating-point/rounding mode expression, abstracting
+ * expensive operators (fp.div, fp.sqrt, fp.rem, fp.fma) by fresh variables
+ * if BZLA_OPT_FP_LAZY_WORD_BLAST is enabled.
+ */
+BzlaNode *bzla_fp_word_blast_lazy(Bzla *bzla, BzlaNode *node);
+
+/** Return all currently unrefined abstractions of expensive operators. */
+void bzla_fp_word_blaster_get_abstractions(Bzla *bzla, BzlaNodePtrStack *nodes);
+
+/**
+ * Refine the abstraction of given operator.
+ * The constraints that equate the abstraction with the word-blasted operator
+ * are asserted with the next call to
+ * bzla_fp_word_blaster_add_additional_assertions().
+ */
+void bzla_fp_word_blaster_refine(Bzla *bzla, BzlaNode *node);
 #endif
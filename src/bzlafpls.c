@@ -0,0 +1,1148 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#include "bzlafpls.h"
+
+#include "bzlacore.h"
+#include "bzlaexp.h"
+#include "bzlafp.h"
+#include "bzlalog.h"
+#include "bzlamodel.h"
+#include "bzlaopt.h"
+#include "bzlarm.h"
+#include "utils/bzlahashint.h"
+#include "utils/bzlahashptr.h"
+#include "utils/bzlarng.h"
+#include "utils/bzlautil.h"
+
+/*------------------------------------------------------------------------*/
+
+/* Maximum number of attempts to find a value that yields the target value
+ * during inverse value computation. */
+#define BZLA_FPLS_MAX_ATTEMPTS 8
+/* Maximum ULP distance (as power of two) for randomly chosen values that are
+ * not equal to a given value. Capped at bw - 1 for formats of bit-width bw. */
+#define BZLA_FPLS_MAX_ULP_SHIFT 16
+
+/*------------------------------------------------------------------------*/
+
+struct BzlaFPLS
+{
+  Bzla *bzla;
+  /* All nodes in the cone of the roots, in ascending id order. */
+  BzlaNodePtrStack nodes;
+  /* The constraints and assumptions. */
+  BzlaNodePtrStack roots;
+  /* Maps node id to its current value: BzlaFloatingPoint* for floating-point
+   * nodes, BzlaRoundingMode for rounding mode nodes and 0/1 for Boolean
+   * nodes (as value of the regular node). */
+  BzlaIntHashTable *values;
+  BzlaFPLSStats *stats;
+};
+
+typedef struct BzlaFPLS BzlaFPLS;
+
+/* The values of the children of a node. */
+struct BzlaFPLSArgs
+{
+  BzlaFloatingPoint *fp[4];
+  BzlaRoundingMode rm[4];
+  bool b[4];
+};
+
+typedef struct BzlaFPLSArgs BzlaFPLSArgs;
+
+/* A target value, interpreted according to the sort of the node. */
+struct BzlaFPLSTarget
+{
+  BzlaFloatingPoint *fp;
+  BzlaRoundingMode rm;
+  bool b;
+};
+
+typedef struct BzlaFPLSTarget BzlaFPLSTarget;
+
+/*------------------------------------------------------------------------*/
+
+static bool
+is_bool(Bzla *bzla, BzlaNode *exp)
+{
+  return bzla_node_is_bv(bzla, exp) && bzla_node_bv_get_width(bzla, exp) == 1;
+}
+
+static bool
+is_supported(Bzla *bzla, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+
+  if (exp->parameterized) return false;
+
+  switch (exp->kind)
+  {
+    case BZLA_FP_CONST_NODE:
+    case BZLA_RM_CONST_NODE:
+    case BZLA_FP_ABS_NODE:
+    case BZLA_FP_IS_INF_NODE:
+    case BZLA_FP_IS_NAN_NODE:
+    case BZLA_FP_IS_NEG_NODE:
+    case BZLA_FP_IS_NORM_NODE:
+    case BZLA_FP_IS_POS_NODE:
+    case BZLA_FP_IS_SUBNORM_NODE:
+    case BZLA_FP_IS_ZERO_NODE:
+    case BZLA_FP_NEG_NODE:
+    case BZLA_FP_EQ_NODE:
+    case BZLA_FP_LTE_NODE:
+    case BZLA_FP_LT_NODE:
+    case BZLA_FP_SQRT_NODE:
+    case BZLA_FP_REM_NODE:
+    case BZLA_FP_RTI_NODE:
+    case BZLA_FP_TO_FP_FP_NODE:
+    case BZLA_RM_EQ_NODE:
+    case BZLA_FP_ADD_NODE:
+    case BZLA_FP_MUL_NODE:
+    case BZLA_FP_DIV_NODE:
+    case BZLA_FP_FMA_NODE: return true;
+
+    case BZLA_BV_CONST_NODE:
+    case BZLA_BV_AND_NODE: return is_bool(bzla, exp);
+
+    case BZLA_VAR_NODE:
+    case BZLA_COND_NODE:
+      return bzla_node_is_fp(bzla, exp) || bzla_node_is_rm(bzla, exp)
+             || is_bool(bzla, exp);
+
+    case BZLA_BV_EQ_NODE:
+      return bzla_node_is_fp(bzla, exp->e[0])
+             || bzla_node_is_rm(bzla, exp->e[0]) || is_bool(bzla, exp->e[0]);
+
+    default: return false;
+  }
+}
+
+static bool
+is_input(BzlaNode *exp)
+{
+  return bzla_node_real_addr(exp)->kind == BZLA_VAR_NODE;
+}
+
+static bool
+is_const(BzlaNode *exp)
+{
+  BzlaNodeKind kind = bzla_node_real_addr(exp)->kind;
+  return kind == BZLA_BV_CONST_NODE || kind == BZLA_FP_CONST_NODE
+         || kind == BZLA_RM_CONST_NODE;
+}
+
+/**
+ * Collect all nodes in the cone of the constraints and assumptions.
+ * Returns false if the cone contains unsupported nodes.
+ */
+static bool
+collect_nodes(Bzla *bzla,
+              BzlaNodePtrStack *nodes,
+              BzlaNodePtrStack *roots)
+{
+  bool res = true;
+  uint32_t i;
+  BzlaNode *cur;
+  BzlaNodePtrStack visit;
+  BzlaIntHashTable *cache;
+  BzlaPtrHashTableIterator it;
+
+  BZLA_INIT_STACK(bzla->mm, visit);
+  cache = bzla_hashint_table_new(bzla->mm);
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    if (roots) BZLA_PUSH_STACK(*roots, cur);
+    BZLA_PUSH_STACK(visit, cur);
+  }
+
+  while (!BZLA_EMPTY_STACK(visit))
+  {
+    cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
+    if (bzla_hashint_table_contains(cache, cur->id)) continue;
+    bzla_hashint_table_add(cache, cur->id);
+
+    if (!is_supported(bzla, cur))
+    {
+      BZLALOG(1, "fpls: unsupported node %s", bzla_util_node2string(cur));
+      res = false;
+      break;
+    }
+
+    if (nodes) BZLA_PUSH_STACK(*nodes, cur);
+    for (i = 0; i < cur->arity; i++) BZLA_PUSH_STACK(visit, cur->e[i]);
+  }
+
+  if (res && nodes)
+  {
+    qsort(nodes->start,
+          BZLA_COUNT_STACK(*nodes),
+          sizeof(BzlaNode *),
+          bzla_node_compare_by_id_qsort_asc);
+  }
+
+  bzla_hashint_table_delete(cache);
+  BZLA_RELEASE_STACK(visit);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+static BzlaFloatingPoint *
+get_fp(BzlaFPLS *ls, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(bzla_node_is_fp(ls->bzla, exp));
+  return bzla_hashint_map_get(ls->values, exp->id)->as_ptr;
+}
+
+static BzlaRoundingMode
+get_rm(BzlaFPLS *ls, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(bzla_node_is_rm(ls->bzla, exp));
+  return bzla_hashint_map_get(ls->values, exp->id)->as_int;
+}
+
+static bool
+get_bool(BzlaFPLS *ls, BzlaNode *exp)
+{
+  bool res;
+  res = bzla_hashint_map_get(ls->values, bzla_node_real_addr(exp)->id)->as_int
+        != 0;
+  return bzla_node_is_inverted(exp) ? !res : res;
+}
+
+static void
+get_args(BzlaFPLS *ls, BzlaNode *exp, BzlaFPLSArgs *args)
+{
+  assert(bzla_node_is_regular(exp));
+
+  uint32_t i;
+  BzlaNode *e;
+
+  memset(args, 0, sizeof(BzlaFPLSArgs));
+  for (i = 0; i < exp->arity; i++)
+  {
+    e = exp->e[i];
+    if (bzla_node_is_fp(ls->bzla, e))
+      args->fp[i] = get_fp(ls, e);
+    else if (bzla_node_is_rm(ls->bzla, e))
+      args->rm[i] = get_rm(ls, e);
+    else
+      args->b[i] = get_bool(ls, e);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+/** Evaluate floating-point node 'exp' w.r.t. given values of its children. */
+static BzlaFloatingPoint *
+eval_fp(BzlaFPLS *ls, BzlaNode *exp, BzlaFPLSArgs *args)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(bzla_node_is_fp(ls->bzla, exp));
+
+  Bzla *bzla = ls->bzla;
+
+  switch (exp->kind)
+  {
+    case BZLA_FP_ABS_NODE: return bzla_fp_abs(bzla, args->fp[0]);
+    case BZLA_FP_NEG_NODE: return bzla_fp_neg(bzla, args->fp[0]);
+    case BZLA_FP_SQRT_NODE:
+      return bzla_fp_sqrt(bzla, args->rm[0], args->fp[1]);
+    case BZLA_FP_RTI_NODE: return bzla_fp_rti(bzla, args->rm[0], args->fp[1]);
+    case BZLA_FP_REM_NODE: return bzla_fp_rem(bzla, args->fp[0], args->fp[1]);
+    case BZLA_FP_ADD_NODE:
+      return bzla_fp_add(bzla, args->rm[0], args->fp[1], args->fp[2]);
+    case BZLA_FP_MUL_NODE:
+      return bzla_fp_mul(bzla, args->rm[0], args->fp[1], args->fp[2]);
+    case BZLA_FP_DIV_NODE:
+      return bzla_fp_div(bzla, args->rm[0], args->fp[1], args->fp[2]);
+    case BZLA_FP_FMA_NODE:
+      return bzla_fp_fma(
+          bzla, args->rm[0], args->fp[1], args->fp[2], args->fp[3]);
+    case BZLA_FP_TO_FP_FP_NODE:
+      return bzla_fp_convert(
+          bzla, bzla_node_get_sort_id(exp), args->rm[0], args->fp[1]);
+    default:
+      assert(exp->kind == BZLA_COND_NODE);
+      return bzla_fp_copy(bzla, args->b[0] ? args->fp[1] : args->fp[2]);
+  }
+}
+
+/** Evaluate Boolean node 'exp' w.r.t. given values of its children. */
+static bool
+eval_bool(BzlaFPLS *ls, BzlaNode *exp, BzlaFPLSArgs *args)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(is_bool(ls->bzla, exp));
+
+  Bzla *bzla = ls->bzla;
+
+  switch (exp->kind)
+  {
+    case BZLA_FP_IS_INF_NODE: return bzla_fp_is_inf(bzla, args->fp[0]);
+    case BZLA_FP_IS_NAN_NODE: return bzla_fp_is_nan(bzla, args->fp[0]);
+    case BZLA_FP_IS_NEG_NODE: return bzla_fp_is_neg(bzla, args->fp[0]);
+    case BZLA_FP_IS_NORM_NODE: return bzla_fp_is_normal(bzla, args->fp[0]);
+    case BZLA_FP_IS_POS_NODE: return bzla_fp_is_pos(bzla, args->fp[0]);
+    case BZLA_FP_IS_SUBNORM_NODE:
+      return bzla_fp_is_subnormal(bzla, args->fp[0]);
+    case BZLA_FP_IS_ZERO_NODE: return bzla_fp_is_zero(bzla, args->fp[0]);
+    case BZLA_FP_EQ_NODE: return bzla_fp_eq(bzla, args->fp[0], args->fp[1]);
+    case BZLA_FP_LTE_NODE: return bzla_fp_lte(bzla, args->fp[0], args->fp[1]);
+    case BZLA_FP_LT_NODE: return bzla_fp_lt(bzla, args->fp[0], args->fp[1]);
+    case BZLA_RM_EQ_NODE: return args->rm[0] == args->rm[1];
+    case BZLA_BV_AND_NODE: return args->b[0] && args->b[1];
+    case BZLA_BV_EQ_NODE:
+      if (bzla_node_is_fp(bzla, exp->e[0]))
+        return bzla_fp_compare(args->fp[0], args->fp[1]) == 0;
+      if (bzla_node_is_rm(bzla, exp->e[0])) return args->rm[0] == args->rm[1];
+      return args->b[0] == args->b[1];
+    default:
+      assert(exp->kind == BZLA_COND_NODE);
+      return args->b[0] ? args->b[1] : args->b[2];
+  }
+}
+
+/**
+ * Recompute the value of non-input node 'exp'.
+ * Returns true if the value changed.
+ */
+static bool
+update_value(BzlaFPLS *ls, BzlaNode *exp)
+{
+  assert(bzla_node_is_regular(exp));
+  assert(!is_input(exp));
+  assert(!is_const(exp));
+
+  bool b;
+  BzlaRoundingMode rm;
+  BzlaFloatingPoint *fp;
+  BzlaFPLSArgs args;
+  BzlaHashTableData *d;
+
+  d = bzla_hashint_map_get(ls->values, exp->id);
+  get_args(ls, exp, &args);
+
+  if (bzla_node_is_fp(ls->bzla, exp))
+  {
+    fp = eval_fp(ls, exp, &args);
+    if (bzla_fp_compare(fp, d->as_ptr) == 0)
+    {
+      bzla_fp_free(ls->bzla, fp);
+      return false;
+    }
+    bzla_fp_free(ls->bzla, d->as_ptr);
+    d->as_ptr = fp;
+    return true;
+  }
+  if (bzla_node_is_rm(ls->bzla, exp))
+  {
+    assert(exp->kind == BZLA_COND_NODE);
+    rm = args.b[0] ? args.rm[1] : args.rm[2];
+    if (rm == (BzlaRoundingMode) d->as_int) return false;
+    d->as_int = rm;
+    return true;
+  }
+  b = eval_bool(ls, exp, &args);
+  if (b == (d->as_int != 0)) return false;
+  d->as_int = b;
+  return true;
+}
+
+/** Initialize the values of all nodes. */
+static void
+init_values(BzlaFPLS *ls)
+{
+  size_t i;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaHashTableData *d;
+
+  bzla = ls->bzla;
+  for (i = 0; i < BZLA_COUNT_STACK(ls->nodes); i++)
+  {
+    cur = BZLA_PEEK_STACK(ls->nodes, i);
+    d   = bzla_hashint_map_add(ls->values, cur->id);
+    if (bzla_node_is_fp_const(cur))
+    {
+      d->as_ptr = bzla_fp_copy(bzla, bzla_fp_get_fp(cur));
+    }
+    else if (bzla_node_is_rm_const(cur))
+    {
+      d->as_int = bzla_node_rm_const_get_rm(cur);
+    }
+    else if (bzla_node_is_bv_const(cur))
+    {
+      d->as_int = bzla_bv_is_true(bzla_node_bv_const_get_bits(cur));
+    }
+    else if (is_input(cur))
+    {
+      if (bzla_node_is_fp(bzla, cur))
+        d->as_ptr = bzla_fp_zero(bzla, bzla_node_get_sort_id(cur), false);
+      else if (bzla_node_is_rm(bzla, cur))
+        d->as_int = BZLA_RM_RNE;
+      else
+        d->as_int = 0;
+    }
+    else
+    {
+      /* initialize with dummy value, replaced in update_value */
+      if (bzla_node_is_fp(bzla, cur))
+        d->as_ptr = bzla_fp_zero(bzla, bzla_node_get_sort_id(cur), false);
+      update_value(ls, cur);
+    }
+  }
+}
+
+/** Update the values in the cone of influence of input 'input'. */
+static void
+update_cone(BzlaFPLS *ls, BzlaNode *input)
+{
+  assert(bzla_node_is_regular(input));
+  assert(is_input(input));
+
+  size_t i;
+  uint32_t j;
+  BzlaNode *cur;
+  BzlaIntHashTable *changed;
+
+  changed = bzla_hashint_table_new(ls->bzla->mm);
+  bzla_hashint_table_add(changed, input->id);
+  for (i = 0; i < BZLA_COUNT_STACK(ls->nodes); i++)
+  {
+    cur = BZLA_PEEK_STACK(ls->nodes, i);
+    if (cur->id <= input->id || is_input(cur) || is_const(cur)) continue;
+    for (j = 0; j < cur->arity; j++)
+    {
+      if (bzla_hashint_table_contains(changed,
+                                      bzla_node_real_addr(cur->e[j])->id))
+      {
+        if (update_value(ls, cur)) bzla_hashint_table_add(changed, cur->id);
+        break;
+      }
+    }
+  }
+  bzla_hashint_table_delete(changed);
+}
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Return the floating-point value that is 'k' ULPs (units in the last place)
+ * away from 'fp', i.e., the k-th next representable value towards +inf (if
+ * k > 0) or -inf (if k < 0). NaN values are not shifted, and values beyond
+ * the infinities are saturated.
+ */
+static BzlaFloatingPoint *
+fp_ulp_shift(Bzla *bzla, BzlaSortId sort, BzlaFloatingPoint *fp, int64_t k)
+{
+  uint32_t bw;
+  BzlaMemMgr *mm;
+  BzlaBitVector *bv, *ord, *delta, *tmp;
+  BzlaFloatingPoint *res;
+
+  if (k == 0 || bzla_fp_is_nan(bzla, fp)) return bzla_fp_copy(bzla, fp);
+
+  mm = bzla->mm;
+  bv = bzla_fp_as_bv(bzla, fp);
+  bw = bzla_bv_get_width(bv);
+
+  /* Map the IEEE representation to an unsigned integer that is monotonic in
+   * the represented value: negative values are ordered inversely by their
+   * magnitude, positive values are offset by the sign bit. */
+  if (bzla_bv_get_bit(bv, bw - 1))
+  {
+    ord = bzla_bv_not(mm, bv);
+  }
+  else
+  {
+    ord = bzla_bv_copy(mm, bv);
+    bzla_bv_set_bit(ord, bw - 1, 1);
+  }
+  bzla_bv_free(mm, bv);
+
+  /* saturate distances that are not representable with bw bits, the
+   * result is saturated below anyway */
+  if (bw < 64 && (uint64_t) (k > 0 ? k : -k) >= ((uint64_t) 1 << bw))
+    delta = bzla_bv_ones(mm, bw);
+  else
+    delta = bzla_bv_uint64_to_bv(mm, k > 0 ? k : -k, bw);
+  if (k > 0)
+  {
+    tmp = bzla_bv_add(mm, ord, delta);
+    /* saturate on overflow */
+    if (bzla_bv_compare(tmp, ord) < 0)
+    {
+      bzla_bv_free(mm, tmp);
+      tmp = bzla_bv_ones(mm, bw);
+    }
+  }
+  else
+  {
+    tmp = bzla_bv_sub(mm, ord, delta);
+    /* saturate on underflow */
+    if (bzla_bv_compare(tmp, ord) > 0)
+    {
+      bzla_bv_free(mm, tmp);
+      tmp = bzla_bv_new(mm, bw);
+    }
+  }
+  bzla_bv_free(mm, delta);
+  bzla_bv_free(mm, ord);
+
+  if (bzla_bv_get_bit(tmp, bw - 1))
+  {
+    bv = bzla_bv_copy(mm, tmp);
+    bzla_bv_set_bit(bv, bw - 1, 0);
+  }
+  else
+  {
+    bv = bzla_bv_not(mm, tmp);
+  }
+  bzla_bv_free(mm, tmp);
+
+  res = bzla_fp_from_bv(bzla, sort, bv);
+  bzla_bv_free(mm, bv);
+
+  /* values beyond the infinities represent NaN */
+  if (bzla_fp_is_nan(bzla, res))
+  {
+    bzla_fp_free(bzla, res);
+    res = bzla_fp_inf(bzla, sort, k < 0);
+  }
+  return res;
+}
+
+/**
+ * Pick a random ULP distance for values of floating-point sort 'sort', small
+ * distances are preferred.
+ */
+static int64_t
+pick_ulps(Bzla *bzla, BzlaSortId sort)
+{
+  uint32_t max_shift;
+
+  if (bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50)) return 1;
+  max_shift = bzla_sort_fp_get_bv_width(bzla, sort) - 1;
+  if (max_shift > BZLA_FPLS_MAX_ULP_SHIFT) max_shift = BZLA_FPLS_MAX_ULP_SHIFT;
+  return ((int64_t) 1) << bzla_rng_pick_rand(bzla->rng, 1, max_shift);
+}
+
+/** Create a normal value with exponent zero, i.e., +-1.0. */
+static BzlaFloatingPoint *
+fp_one(Bzla *bzla, BzlaSortId sort, bool sign)
+{
+  uint32_t i, ew, sw;
+  BzlaBitVector *bv;
+  BzlaFloatingPoint *res;
+
+  ew = bzla_sort_fp_get_exp_width(bzla, sort);
+  sw = bzla_sort_fp_get_sig_width(bzla, sort);
+  bv = bzla_bv_new(bzla->mm, ew + sw);
+  /* biased exponent 2^(ew-1)-1 */
+  for (i = 0; i < ew - 1; i++) bzla_bv_set_bit(bv, sw - 1 + i, 1);
+  if (sign) bzla_bv_set_bit(bv, ew + sw - 1, 1);
+  res = bzla_fp_from_bv(bzla, sort, bv);
+  bzla_bv_free(bzla->mm, bv);
+  return res;
+}
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Compute a candidate value for the floating-point child at index 'pos_x' of
+ * floating-point operation 'exp' such that 'exp' evaluates to 'target'.
+ *
+ * The candidate is computed by applying the inverse operation w.r.t. the
+ * rounding mode of 'exp'. Since the inverse operation is in general not exact
+ * under rounding, the candidate is shifted by 'shift' ULPs.
+ * Returns 0 if no candidate exists.
+ */
+static BzlaFloatingPoint *
+inv_fp_op(BzlaFPLS *ls,
+          BzlaNode *exp,
+          BzlaFPLSArgs *args,
+          uint32_t pos_x,
+          BzlaFloatingPoint *target,
+          int64_t shift)
+{
+  Bzla *bzla;
+  BzlaRoundingMode rm;
+  BzlaSortId sort;
+  BzlaFloatingPoint *res, *tmp0, *tmp1;
+
+  bzla = ls->bzla;
+  rm   = args->rm[0];
+  sort = bzla_node_get_sort_id(exp->e[pos_x]);
+  res  = 0;
+
+  switch (exp->kind)
+  {
+    case BZLA_FP_NEG_NODE: res = bzla_fp_neg(bzla, target); break;
+
+    case BZLA_FP_ABS_NODE:
+      if (bzla_fp_is_neg(bzla, target) && !bzla_fp_is_nan(bzla, target))
+        return 0;
+      res = bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50)
+                ? bzla_fp_neg(bzla, target)
+                : bzla_fp_copy(bzla, target);
+      break;
+
+    case BZLA_FP_SQRT_NODE:
+      if (bzla_fp_is_neg(bzla, target) && !bzla_fp_is_zero(bzla, target)
+          && !bzla_fp_is_nan(bzla, target))
+        return 0;
+      res = bzla_fp_mul(bzla, rm, target, target);
+      break;
+
+    case BZLA_FP_RTI_NODE:
+    case BZLA_FP_REM_NODE:
+      /* x = t is an integral value if t is integral, and rem(t, y) = t if
+       * |t| <= |y|/2 */
+      if (exp->kind == BZLA_FP_REM_NODE && pos_x != 0) return 0;
+      res = bzla_fp_copy(bzla, target);
+      break;
+
+    case BZLA_FP_ADD_NODE:
+      tmp0 = bzla_fp_neg(bzla, args->fp[pos_x == 1 ? 2 : 1]);
+      res  = bzla_fp_add(bzla, rm, target, tmp0);
+      bzla_fp_free(bzla, tmp0);
+      break;
+
+    case BZLA_FP_MUL_NODE:
+      res = bzla_fp_div(bzla, rm, target, args->fp[pos_x == 1 ? 2 : 1]);
+      break;
+
+    case BZLA_FP_DIV_NODE:
+      res = pos_x == 1 ? bzla_fp_mul(bzla, rm, target, args->fp[2])
+                       : bzla_fp_div(bzla, rm, args->fp[1], target);
+      break;
+
+    case BZLA_FP_FMA_NODE:
+      if (pos_x == 3)
+      {
+        tmp0 = bzla_fp_neg(bzla, args->fp[1]);
+        res  = bzla_fp_fma(bzla, rm, tmp0, args->fp[2], target);
+        bzla_fp_free(bzla, tmp0);
+      }
+      else
+      {
+        tmp0 = bzla_fp_neg(bzla, args->fp[3]);
+        tmp1 = bzla_fp_add(bzla, rm, target, tmp0);
+        res  = bzla_fp_div(bzla, rm, tmp1, args->fp[pos_x == 1 ? 2 : 1]);
+        bzla_fp_free(bzla, tmp1);
+        bzla_fp_free(bzla, tmp0);
+      }
+      break;
+
+    case BZLA_FP_TO_FP_FP_NODE:
+      res = bzla_fp_convert(bzla, sort, rm, target);
+      break;
+
+    default: assert(false);
+  }
+
+  if (shift)
+  {
+    tmp0 = res;
+    res  = fp_ulp_shift(bzla, sort, tmp0, shift);
+    bzla_fp_free(bzla, tmp0);
+  }
+  return res;
+}
+
+/**
+ * Compute a candidate value for the floating-point child at index 'pos_x' of
+ * Boolean node 'exp' such that 'exp' evaluates to 'target'.
+ * Returns 0 if no candidate exists.
+ */
+static BzlaFloatingPoint *
+inv_fp_pred(BzlaFPLS *ls,
+            BzlaNode *exp,
+            BzlaFPLSArgs *args,
+            uint32_t pos_x,
+            bool target)
+{
+  bool sign;
+  uint32_t sw;
+  Bzla *bzla;
+  BzlaSortId sort;
+  BzlaFloatingPoint *x, *s, *tmp;
+  int64_t ulps;
+
+  bzla = ls->bzla;
+  sort = bzla_node_get_sort_id(exp->e[pos_x]);
+  x    = args->fp[pos_x];
+  s    = exp->arity > 1 ? args->fp[1 - pos_x] : 0;
+  sign = bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50);
+  ulps = pick_ulps(bzla, sort);
+
+  switch (exp->kind)
+  {
+    case BZLA_FP_IS_ZERO_NODE:
+      if (target) return bzla_fp_zero(bzla, sort, sign);
+      tmp = bzla_fp_zero(bzla, sort, false);
+      x   = fp_ulp_shift(bzla, sort, tmp, sign ? -ulps : ulps);
+      bzla_fp_free(bzla, tmp);
+      return x;
+
+    case BZLA_FP_IS_INF_NODE:
+      if (target) return bzla_fp_inf(bzla, sort, sign);
+      if (bzla_fp_is_inf(bzla, x))
+        return fp_ulp_shift(
+            bzla, sort, x, bzla_fp_is_neg(bzla, x) ? ulps : -ulps);
+      return bzla_fp_zero(bzla, sort, sign);
+
+    case BZLA_FP_IS_NAN_NODE:
+      if (target) return bzla_fp_nan(bzla, sort);
+      return bzla_fp_zero(bzla, sort, sign);
+
+    case BZLA_FP_IS_NEG_NODE:
+    case BZLA_FP_IS_POS_NODE:
+      if (target == (exp->kind == BZLA_FP_IS_POS_NODE))
+      {
+        if (bzla_fp_is_nan(bzla, x)) return bzla_fp_zero(bzla, sort, false);
+        return bzla_fp_abs(bzla, x);
+      }
+      if (bzla_fp_is_nan(bzla, x)) return bzla_fp_zero(bzla, sort, true);
+      tmp = bzla_fp_abs(bzla, x);
+      x   = bzla_fp_neg(bzla, tmp);
+      bzla_fp_free(bzla, tmp);
+      return x;
+
+    case BZLA_FP_IS_NORM_NODE:
+      if (!target) return bzla_fp_zero(bzla, sort, sign);
+      tmp = fp_one(bzla, sort, sign);
+      x   = fp_ulp_shift(bzla, sort, tmp, sign ? -ulps : ulps);
+      bzla_fp_free(bzla, tmp);
+      return x;
+
+    case BZLA_FP_IS_SUBNORM_NODE:
+      if (!target) return bzla_fp_zero(bzla, sort, sign);
+      tmp = bzla_fp_zero(bzla, sort, false);
+      /* the smallest 2^(sw-1)-1 positive values are subnormal */
+      sw = bzla_sort_fp_get_sig_width(bzla, sort);
+      if (sw - 1 < 63)
+      {
+        ulps = 1 + (ulps - 1) % ((((int64_t) 1) << (sw - 1)) - 1);
+      }
+      x = fp_ulp_shift(bzla, sort, tmp, sign ? -ulps : ulps);
+      bzla_fp_free(bzla, tmp);
+      return x;
+
+    case BZLA_FP_EQ_NODE:
+    case BZLA_BV_EQ_NODE:
+      assert(s);
+      if (target)
+      {
+        if (exp->kind == BZLA_FP_EQ_NODE && bzla_fp_is_nan(bzla, s)) return 0;
+        if (exp->kind == BZLA_FP_EQ_NODE && bzla_fp_is_zero(bzla, s))
+          return bzla_fp_zero(bzla, sort, sign);
+        return bzla_fp_copy(bzla, s);
+      }
+      if (bzla_fp_is_nan(bzla, s)) return bzla_fp_zero(bzla, sort, sign);
+      return fp_ulp_shift(bzla, sort, s, sign ? -ulps : ulps);
+
+    case BZLA_FP_LT_NODE:
+    case BZLA_FP_LTE_NODE:
+      assert(s);
+      if (bzla_fp_is_nan(bzla, s))
+      {
+        /* comparisons with NaN are always false */
+        return target ? 0 : bzla_fp_zero(bzla, sort, sign);
+      }
+      /* x < s, x <= s, !(s < x), !(s <= x) -> shift down from s,
+       * otherwise shift up from s */
+      if (target == (pos_x == 0))
+        return fp_ulp_shift(bzla, sort, s, -ulps);
+      return fp_ulp_shift(bzla, sort, s, ulps);
+
+    default: assert(false); return 0;
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Select the path to propagate target value 't' along from node 'exp' and
+ * compute the target value for the selected child.
+ * Returns the index of the selected child or -1 on conflict.
+ */
+static int32_t
+select_path_and_compute_value(BzlaFPLS *ls,
+                              BzlaNode *exp,
+                              BzlaFPLSTarget *t,
+                              BzlaFPLSTarget *tx)
+{
+  assert(bzla_node_is_regular(exp));
+
+  uint32_t i, n, attempt;
+  int32_t pos_x;
+  int32_t cand[4];
+  bool ok;
+  Bzla *bzla;
+  BzlaNode *e;
+  BzlaFPLSArgs args;
+  BzlaFloatingPoint *fp, *res, *orig;
+  BzlaFPLSStats *stats;
+
+  bzla  = ls->bzla;
+  stats = ls->stats;
+  get_args(ls, exp, &args);
+  memset(tx, 0, sizeof(BzlaFPLSTarget));
+
+  /* collect candidate paths (non-constant children) */
+  for (i = 0, n = 0; i < exp->arity; i++)
+  {
+    if (is_const(exp->e[i])) continue;
+    if (exp->kind == BZLA_FP_REM_NODE && i != 0) continue;
+    /* conjunction with target true: only consider false children */
+    if (exp->kind == BZLA_BV_AND_NODE && t->b && args.b[i]) continue;
+    cand[n++] = i;
+  }
+  if (n == 0) return -1;
+
+  if (exp->kind == BZLA_COND_NODE)
+  {
+    /* flip condition or propagate along enabled branch */
+    pos_x = args.b[0] ? 1 : 2;
+    if (is_const(exp->e[pos_x])
+        || (!is_const(exp->e[0])
+            && bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50)))
+    {
+      if (is_const(exp->e[0])) return -1;
+      tx->b = !args.b[0];
+      return 0;
+    }
+    *tx = *t;
+    if (t->fp) tx->fp = bzla_fp_copy(bzla, t->fp);
+    return pos_x;
+  }
+
+  pos_x = cand[bzla_rng_pick_rand(bzla->rng, 0, n - 1)];
+  e     = exp->e[pos_x];
+
+  /* for floating-point operations, prefer the floating-point operands over
+   * the rounding mode (which is always the first child) */
+  if (n > 1 && bzla_node_is_fp(bzla, exp) && bzla_node_is_rm(bzla, e)
+      && !bzla_rng_pick_with_prob(bzla->rng, BZLA_PROB_50 / 5))
+  {
+    pos_x = cand[bzla_rng_pick_rand(bzla->rng, 1, n - 1)];
+    e     = exp->e[pos_x];
+  }
+
+  if (bzla_node_is_rm(bzla, e))
+  {
+    if (exp->kind == BZLA_RM_EQ_NODE || exp->kind == BZLA_BV_EQ_NODE)
+    {
+      /* equal to or different from the other side */
+      tx->rm = args.rm[1 - pos_x];
+      if (!t->b)
+        tx->rm = (tx->rm + bzla_rng_pick_rand(bzla->rng, 1, BZLA_RM_MAX - 1))
+                 % BZLA_RM_MAX;
+    }
+    else
+    {
+      /* any other rounding mode */
+      tx->rm = (args.rm[pos_x]
+                + bzla_rng_pick_rand(bzla->rng, 1, BZLA_RM_MAX - 1))
+               % BZLA_RM_MAX;
+    }
+    return pos_x;
+  }
+
+  if (is_bool(bzla, e))
+  {
+    if (exp->kind == BZLA_BV_AND_NODE)
+      tx->b = t->b;
+    else
+    {
+      assert(exp->kind == BZLA_BV_EQ_NODE);
+      tx->b = t->b ? args.b[1 - pos_x] : !args.b[1 - pos_x];
+    }
+    return pos_x;
+  }
+
+  /* floating-point child */
+  stats->props += 1;
+  orig = args.fp[pos_x];
+  res  = 0;
+  ok   = false;
+  for (attempt = 0; attempt < BZLA_FPLS_MAX_ATTEMPTS && !ok; attempt++)
+  {
+    if (bzla_node_is_fp(bzla, exp))
+    {
+      /* 0, +1, -1, +2, -2, ... ULPs around the inverse value */
+      fp = inv_fp_op(ls,
+                     exp,
+                     &args,
+                     pos_x,
+                     t->fp,
+                     attempt % 2 ? (attempt + 1) / 2 : -(int64_t) attempt / 2);
+    }
+    else
+    {
+      fp = inv_fp_pred(ls, exp, &args, pos_x, t->b);
+    }
+    if (!fp) break;
+
+    args.fp[pos_x] = fp;
+    if (bzla_node_is_fp(bzla, exp))
+    {
+      BzlaFloatingPoint *val = eval_fp(ls, exp, &args);
+      ok                     = bzla_fp_compare(val, t->fp) == 0;
+      bzla_fp_free(bzla, val);
+    }
+    else
+    {
+      ok = eval_bool(ls, exp, &args) == t->b;
+    }
+    args.fp[pos_x] = orig;
+
+    if (ok || !res)
+    {
+      if (res) bzla_fp_free(bzla, res);
+      res = fp;
+    }
+    else
+    {
+      bzla_fp_free(bzla, fp);
+    }
+  }
+
+  if (!res)
+  {
+    stats->conflicts += 1;
+    return -1;
+  }
+  if (ok)
+    stats->props_inv += 1;
+  else
+    stats->props_cons += 1;
+  tx->fp = res;
+  return pos_x;
+}
+
+/**
+ * Perform a move: propagate target value true from an unsatisfied root down
+ * to an input and update the assignment.
+ */
+static void
+move(BzlaFPLS *ls, BzlaNode *root)
+{
+  int32_t pos_x;
+  Bzla *bzla;
+  BzlaNode *cur, *real_cur;
+  BzlaFPLSTarget t, tx;
+  BzlaHashTableData *d;
+
+  bzla = ls->bzla;
+  cur  = root;
+  memset(&t, 0, sizeof(BzlaFPLSTarget));
+  t.b = true;
+
+  for (;;)
+  {
+    real_cur = bzla_node_real_addr(cur);
+    if (bzla_node_is_inverted(cur)) t.b = !t.b;
+
+    if (is_input(real_cur))
+    {
+      BZLALOG(1, "fpls: move %s", bzla_util_node2string(real_cur));
+      d = bzla_hashint_map_get(ls->values, real_cur->id);
+      if (bzla_node_is_fp(bzla, real_cur))
+      {
+        bzla_fp_free(bzla, d->as_ptr);
+        d->as_ptr = t.fp;
+        t.fp      = 0;
+      }
+      else if (bzla_node_is_rm(bzla, real_cur))
+      {
+        d->as_int = t.rm;
+      }
+      else
+      {
+        d->as_int = t.b;
+      }
+      update_cone(ls, real_cur);
+      ls->stats->moves += 1;
+      break;
+    }
+
+    if (is_const(real_cur)) break;
+
+    pos_x = select_path_and_compute_value(ls, real_cur, &t, &tx);
+    if (t.fp) bzla_fp_free(bzla, t.fp);
+    t = tx;
+    if (pos_x < 0) break;
+    cur = real_cur->e[pos_x];
+  }
+
+  if (t.fp) bzla_fp_free(bzla, t.fp);
+}
+
+/**
+ * Confirm the current assignment by re-evaluating all nodes from scratch
+ * (rather than relying on the incremental updates of the moves).
+ * Returns true if all roots evaluate to true.
+ */
+static bool
+confirm(BzlaFPLS *ls)
+{
+  size_t i;
+  BzlaNode *cur;
+
+  for (i = 0; i < BZLA_COUNT_STACK(ls->nodes); i++)
+  {
+    cur = BZLA_PEEK_STACK(ls->nodes, i);
+    if (is_input(cur) || is_const(cur)) continue;
+    update_value(ls, cur);
+  }
+  for (i = 0; i < BZLA_COUNT_STACK(ls->roots); i++)
+  {
+    if (!get_bool(ls, BZLA_PEEK_STACK(ls->roots, i))) return false;
+  }
+  return true;
+}
+
+/**
+ * Add the values of all nodes to 'bv_model'. Floating-point values are
+ * represented as their IEEE-754 bit-vector, rounding modes as their
+ * bit-vector encoding and Boolean values as bit-vectors of size one.
+ */
+static void
+add_to_model(BzlaFPLS *ls, BzlaIntHashTable *bv_model)
+{
+  size_t i;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+
+  bzla = ls->bzla;
+  for (i = 0; i < BZLA_COUNT_STACK(ls->nodes); i++)
+  {
+    cur = BZLA_PEEK_STACK(ls->nodes, i);
+    if (bzla_hashint_map_contains(bv_model, cur->id)) continue;
+
+    if (bzla_node_is_fp(bzla, cur))
+      bv = bzla_fp_as_bv(bzla, get_fp(ls, cur));
+    else if (bzla_node_is_rm(bzla, cur))
+      bv = bzla_bv_uint64_to_bv(bzla->mm, get_rm(ls, cur), BZLA_RM_BW);
+    else
+      bv = get_bool(ls, cur) ? bzla_bv_one(bzla->mm, 1)
+                             : bzla_bv_new(bzla->mm, 1);
+
+    /* inputs are word-blasted when the model values of terms that do not
+     * occur in the formula are queried, hence the components of their
+     * word-blasted representation need to be assigned, too */
+    if (is_input(cur) && !is_bool(bzla, cur))
+      bzla_fp_word_blaster_add_to_model(bzla, bv_model, cur, bv);
+
+    bzla_model_add_to_bv(bzla, bv_model, cur, bv);
+    bzla_bv_free(bzla->mm, bv);
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
+bool
+bzla_fpls_is_supported(Bzla *bzla)
+{
+  assert(bzla);
+  if (bzla->ufs->count > 0 || bzla->lambdas->count > 0) return false;
+  return collect_nodes(bzla, 0, 0);
+}
+
+BzlaSolverResult
+bzla_fpls_sat(Bzla *bzla,
+              uint64_t max_moves,
+              BzlaIntHashTable *bv_model,
+              BzlaFPLSStats *stats)
+{
+  assert(bzla);
+  assert(bv_model);
+  assert(stats);
+
+  size_t i;
+  uint64_t moves;
+  BzlaSolverResult res;
+  BzlaFPLS ls;
+  BzlaNode *cur;
+  BzlaNodePtrStack unsat;
+  BzlaHashTableData *d;
+
+  res = BZLA_RESULT_UNKNOWN;
+
+  memset(&ls, 0, sizeof(BzlaFPLS));
+  ls.bzla  = bzla;
+  ls.stats = stats;
+  BZLA_INIT_STACK(bzla->mm, ls.nodes);
+  BZLA_INIT_STACK(bzla->mm, ls.roots);
+  BZLA_INIT_STACK(bzla->mm, unsat);
+  ls.values = bzla_hashint_map_new(bzla->mm);
+
+  if (!collect_nodes(bzla, &ls.nodes, &ls.roots)) goto DONE;
+
+  init_values(&ls);
+
+  for (moves = 0;; moves++)
+  {
+    BZLA_RESET_STACK(unsat);
+    for (i = 0; i < BZLA_COUNT_STACK(ls.roots); i++)
+    {
+      cur = BZLA_PEEK_STACK(ls.roots, i);
+      if (!get_bool(&ls, cur)) BZLA_PUSH_STACK(unsat, cur);
+    }
+    if (BZLA_EMPTY_STACK(unsat))
+    {
+      if (confirm(&ls)) res = BZLA_RESULT_SAT;
+      break;
+    }
+    if (moves >= max_moves || bzla_terminate(bzla)) break;
+
+    move(&ls,
+         BZLA_PEEK_STACK(
+             unsat,
+             bzla_rng_pick_rand(bzla->rng, 0, BZLA_COUNT_STACK(unsat) - 1)));
+  }
+
+  BZLA_MSG(bzla->msg,
+           1,
+           "fpls: %s after %zu moves",
+           res == BZLA_RESULT_SAT ? "sat" : "unknown",
+           moves);
+
+  if (res == BZLA_RESULT_SAT) add_to_model(&ls, bv_model);
+
+DONE:
+  for (i = 0; i < BZLA_COUNT_STACK(ls.nodes); i++)
+  {
+    cur = BZLA_PEEK_STACK(ls.nodes, i);
+    if (bzla_node_is_fp(bzla, cur)
+        && (d = bzla_hashint_map_get(ls.values, cur->id)))
+    {
+      bzla_fp_free(bzla, d->as_ptr);
+    }
+  }
+  bzla_hashint_map_delete(ls.values);
+  BZLA_RELEASE_STACK(unsat);
+  BZLA_RELEASE_STACK(ls.roots);
+  BZLA_RELEASE_STACK(ls.nodes);
+  return res;
+}
@@ -0,0 +1,71 @@
+/***
+ * Bitwuzla: Satisfiability Modulo Theories (SMT) solver.
+ *
+ * This file is part of Bitwuzla.
+ *
+ * Copyright (C) 2007-2022 by the authors listed in the AUTHORS file.
+ *
+ * See COPYING for more information on using this software.
+ */
+
+#ifndef BZLAFPLS_H_INCLUDED
+#define BZLAFPLS_H_INCLUDED
+
+#include "bzlanode.h"
+#include "bzlaslv.h"
+#include "bzlatypes.h"
+
+/*------------------------------------------------------------------------*/
+
+/**
+ * Floating-point local search.
+ *
+ * Propagation-based local search that operates directly on floating-point
+ * values: floating-point terms are evaluated concretely (via the bzla_fp_*
+ * operations on literals) rather than on their word-blasted bit-vector
+ * circuits, and target values are propagated down to floating-point,
+ * rounding mode and Boolean inputs via floating-point level inverse and
+ * consistent value computation.
+ */
+
+struct BzlaFPLSStats
+{
+  /* Number of moves. */
+  uint64_t moves;
+  /* Number of propagation steps. */
+  uint64_t props;
+  /* Number of propagation steps via exact (rounding-mode aware) inverse
+   * value computation. */
+  uint64_t props_inv;
+  /* Number of propagation steps where no exact inverse value was found and
+   * the closest candidate value was propagated. */
+  uint64_t props_cons;
+  /* Number of propagation steps that hit a conflict. */
+  uint64_t conflicts;
+};
+
+typedef struct BzlaFPLSStats BzlaFPLSStats;
+
+/**
+ * Return true if all constraints and assumptions are supported by the
+ * floating-point local search, i.e., if they only consist of floating-point,
+ * rounding mode and Boolean inputs, floating-point operations that can be
+ * evaluated concretely, and Boolean structure.
+ */
+bool bzla_fpls_is_supported(Bzla *bzla);
+
+/**
+ * Run floating-point local search on all constraints and assumptions for at
+ * most 'max_moves' moves.
+ *
+ * Returns BZLA_RESULT_SAT if a satisfying assignment was found (and confirmed
+ * by concrete evaluation of all constraints and assumptions), and
+ * BZLA_RESULT_UNKNOWN otherwise. On SAT, the values of all nodes in the cone
+ * of the constraints and assumptions are added to 'bv_model'.
+ */
+BzlaSolverResult bzla_fpls_sat(Bzla *bzla,
+                               uint64_t max_moves,
+                               BzlaIntHashTable *bv_model,
+                               BzlaFPLSStats *stats);
+
+#endif
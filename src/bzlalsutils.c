@@ -18,14 +18,54 @@
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
+void
+bzla_lsutils_roots_add(BzlaIntHashTable *roots,
+                       BzlaIntStack *roots_stack,
+                       int32_t id)
+{
+  assert(roots);
+  assert(roots_stack);
+  assert(!bzla_hashint_map_contains(roots, id));
+
+  bzla_hashint_map_add(roots, id)->as_int = BZLA_COUNT_STACK(*roots_stack);
+  BZLA_PUSH_STACK(*roots_stack, id);
+}
+
+void
+bzla_lsutils_roots_remove(BzlaIntHashTable *roots,
+                          BzlaIntStack *roots_stack,
+                          int32_t id)
+{
+  assert(roots);
+  assert(roots_stack);
+  assert(bzla_hashint_map_contains(roots, id));
+
+  int32_t pos, last;
+  BzlaHashTableData d;
+
+  bzla_hashint_map_remove(roots, id, &d);
+  pos = d.as_int;
+  assert(pos >= 0 && (size_t) pos < BZLA_COUNT_STACK(*roots_stack));
+  assert(BZLA_PEEK_STACK(*roots_stack, pos) == id);
+  last = BZLA_POP_STACK(*roots_stack);
+  /* move last element into the gap */
+  if (last != id)
+  {
+    BZLA_POKE_STACK(*roots_stack, pos, last);
+    bzla_hashint_map_get(roots, last)->as_int = pos;
+  }
+}
+
 static void
 update_roots_table(Bzla *bzla,
                    BzlaIntHashTable *roots,
+                   BzlaIntStack *roots_stack,
                    BzlaNode *exp,
                    BzlaBitVector *bv)
 {
   assert(bzla);
   assert(roots);
+  assert(roots_stack);
   assert(exp);
   assert(bzla_node_is_regular(exp));
   assert(bv);
@@ -37,7 +77,7 @@ update_roots_table(Bzla *bzla,
    *      -> satisfied, remove */
   if (bzla_hashint_map_get(roots, exp->id))
   {
-    bzla_hashint_map_remove(roots, exp->id, 0);
+    bzla_lsutils_roots_remove(roots, roots_stack, exp->id);
     assert(bzla_bv_is_false(bzla_model_get_bv(bzla, exp)));
     assert(bzla_bv_is_true(bv));
   }
@@ -45,7 +85,7 @@ update_roots_table(Bzla *bzla,
    * -> satisfied, remove */
   else if (bzla_hashint_map_get(roots, -exp->id))
   {
-    bzla_hashint_map_remove(roots, -exp->id, 0);
+    bzla_lsutils_roots_remove(roots, roots_stack, -exp->id);
     assert(bzla_bv_is_false(bzla_model_get_bv(bzla, bzla_node_invert(exp))));
     assert(bzla_bv_is_false(bv));
   }
@@ -53,7 +93,7 @@ update_roots_table(Bzla *bzla,
    * -> unsatisfied, add */
   else if (bzla_bv_is_false(bv))
   {
-    bzla_hashint_map_add(roots, exp->id);
+    bzla_lsutils_roots_add(roots, roots_stack, exp->id);
     assert(bzla_bv_is_true(bzla_model_get_bv(bzla, exp)));
   }
   /* -exp: old assignment = 1, new assignment = 0 (bv = 1)
@@ -61,7 +101,7 @@ update_roots_table(Bzla *bzla,
   else
   {
     assert(bzla_bv_is_true(bv));
-    bzla_hashint_map_add(roots, -exp->id);
+    bzla_lsutils_roots_add(roots, roots_stack, -exp->id);
     assert(bzla_bv_is_true(bzla_model_get_bv(bzla, bzla_node_invert(exp))));
   }
 }
@@ -84,6 +124,7 @@ void
 bzla_lsutils_update_cone(Bzla *bzla,
                          BzlaIntHashTable *bv_model,
                          BzlaIntHashTable *roots,
+                         BzlaIntStack *roots_stack,
                          BzlaIntHashTable *score,
                          BzlaIntHashTable *exps,
                          bool update_roots,
@@ -98,6 +139,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
          || bzla->slv->kind == BZLA_SLS_SOLVER_KIND);
   assert(bv_model);
   assert(roots);
+  assert(roots_stack);
   assert(exps);
   assert(exps->count);
   assert(bzla->slv->kind != BZLA_PROP_SOLVER_KIND || update_roots);
@@ -193,7 +235,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
         && bzla_bv_compare(d->as_ptr, ass))
     {
       /* old assignment != new assignment */
-      update_roots_table(bzla, roots, exp, ass);
+      update_roots_table(bzla, roots, roots_stack, exp, ass);
     }
     bzla_bv_free(mm, d->as_ptr);
     d->as_ptr = bzla_bv_copy(mm, ass);
@@ -289,7 +331,7 @@ bzla_lsutils_update_cone(Bzla *bzla,
       assert(d); /* must be contained, is root */
       /* old assignment != new assignment */
       if (bzla_bv_compare(d->as_ptr, bv))
-        update_roots_table(bzla, roots, cur, bv);
+        update_roots_table(bzla, roots, roots_stack, cur, bv);
     }
 
     /* update assignments */
@@ -14,6 +14,21 @@
 #include "bzlaslv.h"
 #include "bzlatypes.h"
 #include "utils/bzlahashint.h"
+#include "utils/bzlastack.h"
+
+/**
+ * The set of currently unsatisfied roots is represented as map 'roots', which
+ * maps the (signed) id of each unsatisfied root to its position in stack
+ * 'roots_stack', which holds the ids of all unsatisfied roots.  This allows
+ * to update the set and to select a root uniformly at random in constant
+ * time, independent of the total number of roots.
+ */
+void bzla_lsutils_roots_add(BzlaIntHashTable* roots,
+                            BzlaIntStack* roots_stack,
+                            int32_t id);
+void bzla_lsutils_roots_remove(BzlaIntHashTable* roots,
+                               BzlaIntStack* roots_stack,
+                               int32_t id);
 
 /**
  * Update cone of incluence as a consequence of a local search move.
@@ -26,6 +41,7 @@
 void bzla_lsutils_update_cone(Bzla* bzla,
                               BzlaIntHashTable* bv_model,
                               BzlaIntHashTable* roots,
+                              BzlaIntStack* roots_stack,
                               BzlaIntHashTable* score,
                               BzlaIntHashTable* exps,
                               bool update_roots,
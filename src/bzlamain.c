@@ -67,15 +67,23 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_DECLSORT_BV_WIDTH]       = BITWUZLA_OPT_DECLSORT_BV_WIDTH,
     [BZLA_OPT_ENGINE]                  = BITWUZLA_OPT_ENGINE,
     [BZLA_OPT_EXIT_CODES]              = BITWUZLA_OPT_EXIT_CODES,
+    [BZLA_OPT_FP_LAZY_WORD_BLAST]      = BITWUZLA_OPT_FP_LAZY_WORD_BLAST,
+    [BZLA_OPT_FP_WORD_BLAST_TEMPLATES] = BITWUZLA_OPT_FP_WORD_BLAST_TEMPLATES,
     [BZLA_OPT_FUN_DUAL_PROP]           = BITWUZLA_OPT_FUN_DUAL_PROP,
     [BZLA_OPT_FUN_DUAL_PROP_QSORT]     = BITWUZLA_OPT_FUN_DUAL_PROP_QSORT,
     [BZLA_OPT_FUN_EAGER_LEMMAS]        = BITWUZLA_OPT_FUN_EAGER_LEMMAS,
+    [BZLA_OPT_FUN_HYBRID]              = BITWUZLA_OPT_FUN_HYBRID,
     [BZLA_OPT_FUN_JUST]                = BITWUZLA_OPT_FUN_JUST,
     [BZLA_OPT_FUN_JUST_HEURISTIC]      = BITWUZLA_OPT_FUN_JUST_HEURISTIC,
+    [BZLA_OPT_FUN_PREFPLS]             = BITWUZLA_OPT_FUN_PREFPLS,
     [BZLA_OPT_FUN_LAZY_SYNTHESIZE]     = BITWUZLA_OPT_FUN_LAZY_SYNTHESIZE,
     [BZLA_OPT_FUN_PREPROP]             = BITWUZLA_OPT_FUN_PREPROP,
     [BZLA_OPT_FUN_PRESLS]              = BITWUZLA_OPT_FUN_PRESLS,
     [BZLA_OPT_FUN_STORE_LAMBDAS]       = BITWUZLA_OPT_FUN_STORE_LAMBDAS,
+    [BZLA_OPT_FUN_WEG]                 = BITWUZLA_OPT_FUN_WEG,
+    [BZLA_OPT_FUN_LAZY_MODEL]          = BITWUZLA_OPT_FUN_LAZY_MODEL,
+    [BZLA_OPT_FUN_DYNAMIC_ACK]         = BITWUZLA_OPT_FUN_DYNAMIC_ACK,
+    [BZLA_OPT_FUN_BETA_CACHE]          = BITWUZLA_OPT_FUN_BETA_CACHE,
     [BZLA_OPT_INCREMENTAL]             = BITWUZLA_OPT_INCREMENTAL,
     [BZLA_OPT_INPUT_FORMAT]            = BITWUZLA_OPT_INPUT_FORMAT,
     [BZLA_OPT_LOGLEVEL]                = BITWUZLA_OPT_LOGLEVEL,
@@ -84,6 +92,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
     [BZLA_OPT_OUTPUT_NUMBER_FORMAT]    = BITWUZLA_OPT_OUTPUT_NUMBER_FORMAT,
     [BZLA_OPT_PARSE_INTERACTIVE]       = BITWUZLA_OPT_PARSE_INTERACTIVE,
     [BZLA_OPT_PP_ACKERMANN]            = BITWUZLA_OPT_PP_ACKERMANN,
+    [BZLA_OPT_PP_ACKERMANN_LIMIT]      = BITWUZLA_OPT_PP_ACKERMANN_LIMIT,
     [BZLA_OPT_PP_BETA_REDUCE]          = BITWUZLA_OPT_PP_BETA_REDUCE,
     [BZLA_OPT_PP_ELIMINATE_EXTRACTS]   = BITWUZLA_OPT_PP_ELIMINATE_EXTRACTS,
     [BZLA_OPT_PP_ELIMINATE_ITES]       = BITWUZLA_OPT_PP_ELIMINATE_ITES,
@@ -106,6 +115,7 @@ static BitwuzlaOption bitwuzla_options[BZLA_OPT_NUM_OPTS] = {
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
     [BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL] =
         BITWUZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
+    [BZLA_OPT_PROP_FUN]                 = BITWUZLA_OPT_PROP_FUN,
     [BZLA_OPT_PROP_INFER_INEQ_BOUNDS]   = BITWUZLA_OPT_PROP_INFER_INEQ_BOUNDS,
     [BZLA_OPT_PROP_NO_MOVE_ON_CONFLICT] = BITWUZLA_OPT_PROP_NO_MOVE_ON_CONFLICT,
     [BZLA_OPT_PROP_NPROPS]              = BITWUZLA_OPT_PROP_NPROPS,
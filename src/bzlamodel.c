@@ -460,6 +460,35 @@ recursively_compute_function_model(Bzla *bzla,
   }
 }
 
+static void ensure_model(Bzla *bzla,
+                         BzlaIntHashTable *bv_model,
+                         BzlaIntHashTable *fun_model,
+                         BzlaNode *exps[],
+                         uint32_t nexps);
+
+static void
+ensure_apply_parents_model(Bzla *bzla,
+                           BzlaIntHashTable *bv_model,
+                           BzlaIntHashTable *fun_model,
+                           BzlaNode *fun)
+{
+  BzlaNode *cur;
+  BzlaNodePtrStack applies;
+  BzlaNodeIterator it;
+
+  BZLA_INIT_STACK(bzla->mm, applies);
+  bzla_iter_apply_parent_init(&it, fun);
+  while (bzla_iter_apply_parent_has_next(&it))
+  {
+    cur = bzla_iter_apply_parent_next(&it);
+    if (cur->parameterized) continue;
+    BZLA_PUSH_STACK(applies, cur);
+  }
+  ensure_model(
+      bzla, bv_model, fun_model, applies.start, BZLA_COUNT_STACK(applies));
+  BZLA_RELEASE_STACK(applies);
+}
+
 const BzlaPtrHashTable *
 bzla_model_get_fun_aux(Bzla *bzla,
                        BzlaIntHashTable *bv_model,
@@ -488,7 +517,16 @@ bzla_model_get_fun_aux(Bzla *bzla,
    * that previously existed but was simplified (i.e. the original exp is now
    * a proxy and was therefore regenerated when querying it's assignment via
    * get-value in SMT-LIB v2) */
-  if (!d) recursively_compute_function_model(bzla, bv_model, fun_model, exp);
+  if (!d)
+  {
+    recursively_compute_function_model(bzla, bv_model, fun_model, exp);
+    /* With lazy model generation, the function applications on 'exp' have
+     * not been evaluated yet and thus did not contribute to its model. */
+    if (bzla_opt_get(bzla, BZLA_OPT_FUN_LAZY_MODEL))
+    {
+      ensure_apply_parents_model(bzla, bv_model, fun_model, exp);
+    }
+  }
   d = bzla_hashint_map_get(fun_model, exp->id);
   if (!d) return 0;
 
@@ -598,6 +636,243 @@ bzla_model_get_fun_model(Bzla *bzla,
 
 /*------------------------------------------------------------------------*/
 
+struct BzlaArrayModelEntry
+{
+  BzlaBitVector *index;
+  BzlaBitVector *value;
+};
+typedef struct BzlaArrayModelEntry BzlaArrayModelEntry;
+
+static int32_t
+compare_array_model_entries(const void *p1, const void *p2)
+{
+  const BzlaArrayModelEntry *e1 = p1;
+  const BzlaArrayModelEntry *e2 = p2;
+  return bzla_bv_compare(e1->index, e2->index);
+}
+
+BzlaArrayModel *
+bzla_model_get_array_model_compact(Bzla *bzla, BzlaNode *exp)
+{
+  assert(bzla);
+  assert(exp);
+  assert(bzla_node_is_array(exp));
+
+  uint32_t i, n;
+  BzlaMemMgr *mm;
+  BzlaArrayModel *res;
+  BzlaArrayModelRun *run;
+  BzlaArrayModelEntry *entries;
+  BzlaBitVectorTuple *tup;
+  BzlaBitVector *bv, *next;
+  BzlaPtrHashTableIterator it;
+  const BzlaPtrHashTable *model;
+
+  model = bzla_model_get_fun(bzla, exp);
+  if (!model) return 0;
+
+  mm = bzla->mm;
+  BZLA_CNEW(mm, res);
+
+  n = 0;
+  BZLA_NEWN(mm, entries, model->count);
+  bzla_iter_hashptr_init(&it, model);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    bv  = it.bucket->data.as_ptr;
+    tup = bzla_iter_hashptr_next(&it);
+    if (tup->arity == 0)
+    {
+      assert(!res->default_value);
+      res->default_value = bzla_bv_copy(mm, bv);
+    }
+    else
+    {
+      assert(tup->arity == 1);
+      entries[n].index   = tup->bv[0];
+      entries[n++].value = bv;
+    }
+  }
+  qsort(entries, n, sizeof(BzlaArrayModelEntry), compare_array_model_entries);
+
+  /* Merge contiguous indices with the same value into runs. Entries equal to
+   * the default value were already removed when the model was computed. */
+  if (n) BZLA_NEWN(mm, res->runs, n);
+  run = 0;
+  for (i = 0; i < n; i++)
+  {
+    if (run && !bzla_bv_compare(run->value, entries[i].value)
+        && !bzla_bv_is_ones(run->upper))
+    {
+      next = bzla_bv_inc(mm, run->upper);
+      if (!bzla_bv_compare(next, entries[i].index))
+      {
+        bzla_bv_free(mm, run->upper);
+        run->upper = next;
+        continue;
+      }
+      bzla_bv_free(mm, next);
+    }
+    run        = &res->runs[res->num_runs++];
+    run->lower = bzla_bv_copy(mm, entries[i].index);
+    run->upper = bzla_bv_copy(mm, entries[i].index);
+    run->value = bzla_bv_copy(mm, entries[i].value);
+  }
+  if (res->num_runs < n)
+  {
+    BZLA_REALLOC(mm, res->runs, n, res->num_runs);
+  }
+  BZLA_DELETEN(mm, entries, model->count);
+  return res;
+}
+
+void
+bzla_model_delete_array_model_compact(Bzla *bzla, BzlaArrayModel *model)
+{
+  assert(bzla);
+  assert(model);
+
+  uint32_t i;
+
+  for (i = 0; i < model->num_runs; i++)
+  {
+    bzla_bv_free(bzla->mm, model->runs[i].lower);
+    bzla_bv_free(bzla->mm, model->runs[i].upper);
+    bzla_bv_free(bzla->mm, model->runs[i].value);
+  }
+  if (model->runs) BZLA_DELETEN(bzla->mm, model->runs, model->num_runs);
+  if (model->default_value) bzla_bv_free(bzla->mm, model->default_value);
+  BZLA_DELETE(bzla->mm, model);
+}
+
+const BzlaBitVector *
+bzla_model_array_model_get(const BzlaArrayModel *model,
+                           const BzlaBitVector *index)
+{
+  assert(model);
+  assert(index);
+
+  uint32_t lo, hi, mid;
+  BzlaArrayModelRun *run;
+
+  lo = 0;
+  hi = model->num_runs;
+  while (lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+    run = &model->runs[mid];
+    if (bzla_bv_compare(index, run->lower) < 0)
+    {
+      hi = mid;
+    }
+    else if (bzla_bv_compare(index, run->upper) > 0)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      return run->value;
+    }
+  }
+  return model->default_value;
+}
+
+static BzlaBitVector *
+get_array_value_from_fun_model(Bzla *bzla,
+                               BzlaNode *exp,
+                               const BzlaBitVector *index)
+{
+  BzlaMemMgr *mm;
+  BzlaBitVectorTuple *t;
+  BzlaPtrHashBucket *b;
+  BzlaSortId sort;
+  const BzlaPtrHashTable *model;
+
+  mm    = bzla->mm;
+  b     = 0;
+  model = bzla_model_get_fun(bzla, exp);
+  if (model)
+  {
+    t = bzla_bv_new_tuple(mm, 1);
+    bzla_bv_add_to_tuple(mm, t, index, 0);
+    if (!(b = bzla_hashptr_table_get((BzlaPtrHashTable *) model, t)))
+    {
+      /* 0-arity tuple holds the default value of constant arrays */
+      bzla_bv_free_tuple(mm, t);
+      t = bzla_bv_new_tuple(mm, 0);
+      b = bzla_hashptr_table_get((BzlaPtrHashTable *) model, t);
+    }
+    bzla_bv_free_tuple(mm, t);
+  }
+  if (b) return bzla_bv_copy(mm, b->data.as_ptr);
+
+  /* unconstrained index */
+  sort = bzla_sort_array_get_element(bzla, bzla_node_get_sort_id(exp));
+  if (bzla_sort_is_fp(bzla, sort))
+  {
+    return bzla_bv_new(mm, bzla_sort_fp_get_bv_width(bzla, sort));
+  }
+  if (bzla_sort_is_rm(bzla, sort))
+  {
+    return bzla_bv_new(mm, BZLA_RM_BW);
+  }
+  return bzla_bv_new(mm, bzla_sort_bv_get_width(bzla, sort));
+}
+
+BzlaBitVector *
+bzla_model_get_array_value(Bzla *bzla,
+                           BzlaNode *exp,
+                           const BzlaBitVector *index)
+{
+  assert(bzla);
+  assert(exp);
+  assert(index);
+  assert(bzla_node_is_array(exp));
+
+  BzlaNode *cur;
+  const BzlaBitVector *bv;
+
+  cur = bzla_node_get_simplified(bzla, exp);
+  for (;;)
+  {
+    assert(bzla_node_is_regular(cur));
+    assert(bzla_node_is_array(cur));
+
+    if (bzla_hashint_map_contains(bzla->fun_model, cur->id)
+        || bzla_node_is_uf_array(cur)
+        || (bzla_node_is_lambda(cur) && bzla_node_lambda_get_static_rho(cur)))
+    {
+      return get_array_value_from_fun_model(bzla, cur, index);
+    }
+    else if (bzla_node_is_update(cur))
+    {
+      assert(bzla_node_args_get_arity(bzla, cur->e[1]) == 1);
+      bv = bzla_model_get_bv(bzla, cur->e[1]->e[0]);
+      if (bzla_bv_compare(bv, index) == 0)
+      {
+        return bzla_bv_copy(bzla->mm, bzla_model_get_bv(bzla, cur->e[2]));
+      }
+      cur = cur->e[0];
+    }
+    else if (bzla_node_is_const_array(cur))
+    {
+      return bzla_bv_copy(bzla->mm, bzla_model_get_bv(bzla, cur->e[1]));
+    }
+    else if (bzla_node_is_fun_cond(cur) && !cur->parameterized)
+    {
+      bv  = bzla_model_get_bv(bzla, cur->e[0]);
+      cur = bzla_bv_is_true(bv) ? cur->e[1] : cur->e[2];
+    }
+    else
+    {
+      /* requires beta reduction, not supported lazily */
+      return 0;
+    }
+  }
+}
+
+/*------------------------------------------------------------------------*/
+
 /**
  * Compute the bit-vector value for `exp`.
  *
@@ -742,17 +1017,18 @@ compute_model_values(Bzla *bzla,
   }
 }
 
-/* Ensure that all terms in 'exp' have a model value. Collect all terms in
- * 'exp' that don't have a model value and call corresponding
- * recursively_compute_* functions. */
+/* Ensure that all terms in 'exps' have a model value. Collect all terms in
+ * 'exps' that don't have a model value and call corresponding
+ * recursively_compute_* functions. Terms shared between 'exps' are only
+ * traversed once. */
 static void
 ensure_model(Bzla *bzla,
              BzlaIntHashTable *bv_model,
              BzlaIntHashTable *fun_model,
-             BzlaNode *exp)
+             BzlaNode *exps[],
+             uint32_t nexps)
 {
-  assert(exp);
-  assert(!bzla_node_is_proxy(exp));
+  assert(exps || !nexps);
 
   double start;
   uint32_t i;
@@ -765,8 +1041,12 @@ ensure_model(Bzla *bzla,
   BZLA_INIT_STACK(bzla->mm, nodes);
 
   BZLA_INIT_STACK(bzla->mm, visit);
-  BZLA_PUSH_STACK(visit, exp);
-  do
+  for (i = 0; i < nexps; i++)
+  {
+    assert(!bzla_node_is_proxy(exps[i]));
+    BZLA_PUSH_STACK(visit, exps[i]);
+  }
+  while (!BZLA_EMPTY_STACK(visit))
   {
     cur = bzla_node_real_addr(BZLA_POP_STACK(visit));
 
@@ -786,7 +1066,7 @@ ensure_model(Bzla *bzla,
     {
       BZLA_PUSH_STACK(visit, cur->e[i]);
     }
-  } while (!BZLA_EMPTY_STACK(visit));
+  }
   BZLA_RELEASE_STACK(visit);
   bzla_hashint_table_delete(cache);
 
@@ -842,7 +1122,7 @@ bzla_model_get_bv_aux(Bzla *bzla,
    * assignment via get-value in SMT-LIB v2) */
   if (!d)
   {
-    ensure_model(bzla, bv_model, fun_model, exp);
+    ensure_model(bzla, bv_model, fun_model, &exp, 1);
     d = bzla_hashint_map_get(bv_model, bzla_node_real_addr(exp)->id);
   }
   if (!d) return 0;
@@ -1614,6 +1894,42 @@ bzla_model_recursively_compute_assignment(Bzla *bzla,
 
 /*------------------------------------------------------------------------*/
 
+/**
+ * Get node representation of the model value of array read 'exp' without
+ * computing the model of the whole array (see bzla_model_get_array_value).
+ * Returns 0 if 'exp' is not an array read, or if it already has a model
+ * value.
+ */
+static BzlaNode *
+get_array_read_value(Bzla *bzla, BzlaNode *exp)
+{
+  BzlaNode *real_exp, *res;
+  BzlaBitVector *bv, *tmp;
+  const BzlaBitVector *index;
+
+  real_exp = bzla_node_real_addr(exp);
+  if (!bzla_node_is_apply(real_exp) || !bzla_node_is_array(real_exp->e[0])
+      || bzla_hashint_map_contains(bzla->bv_model, real_exp->id))
+  {
+    return 0;
+  }
+
+  index = bzla_model_get_bv(bzla, real_exp->e[1]->e[0]);
+  bv    = bzla_model_get_array_value(bzla, real_exp->e[0], index);
+  if (!bv) return 0;
+  bzla_model_add_to_bv(bzla, bzla->bv_model, real_exp, bv);
+
+  if (bzla_node_is_inverted(exp))
+  {
+    tmp = bzla_bv_not(bzla->mm, bv);
+    bzla_bv_free(bzla->mm, bv);
+    bv = tmp;
+  }
+  res = bzla_node_mk_value(bzla, bzla_node_get_sort_id(exp), bv);
+  bzla_bv_free(bzla->mm, bv);
+  return res;
+}
+
 BzlaNode *
 bzla_model_get_value(Bzla *bzla, BzlaNode *exp)
 {
@@ -1636,7 +1952,11 @@ bzla_model_get_value(Bzla *bzla, BzlaNode *exp)
   if (bzla_node_is_bv(bzla, exp) || bzla_node_is_fp(bzla, exp)
       || bzla_node_is_rm(bzla, exp))
   {
-    res = bzla_node_mk_value(bzla, sort, bzla_model_get_bv(bzla, exp));
+    res = get_array_read_value(bzla, exp);
+    if (!res)
+    {
+      res = bzla_node_mk_value(bzla, sort, bzla_model_get_bv(bzla, exp));
+    }
   }
   else if ((bzla_node_is_lambda(exp) && bzla_node_fun_get_arity(bzla, exp) > 1)
            || bzla_node_is_const_array(exp))
@@ -1760,6 +2080,48 @@ bzla_model_get_value(Bzla *bzla, BzlaNode *exp)
   return res;
 }
 
+void
+bzla_model_get_values(Bzla *bzla,
+                      BzlaNode *exps[],
+                      uint32_t nexps,
+                      BzlaNode *values[])
+{
+  assert(bzla);
+  assert(exps || !nexps);
+  assert(values || !nexps);
+  assert(bzla->last_sat_result == BZLA_RESULT_SAT && bzla->valid_assignments);
+
+  uint32_t i;
+  BzlaNode *cur, *real_cur;
+  BzlaNodePtrStack roots;
+
+  /* Compute the model values of all terms in one traversal, sharing the
+   * terms below them. Array reads are answered lazily via
+   * get_array_read_value, only their index is computed here. */
+  BZLA_INIT_STACK(bzla->mm, roots);
+  for (i = 0; i < nexps; i++)
+  {
+    cur      = bzla_simplify_exp(bzla, exps[i]);
+    real_cur = bzla_node_real_addr(cur);
+    if (bzla_node_is_apply(real_cur) && bzla_node_is_array(real_cur->e[0]))
+    {
+      cur = real_cur->e[1]->e[0];
+    }
+    BZLA_PUSH_STACK(roots, cur);
+  }
+  ensure_model(bzla,
+               bzla->bv_model,
+               bzla->fun_model,
+               roots.start,
+               BZLA_COUNT_STACK(roots));
+  BZLA_RELEASE_STACK(roots);
+
+  for (i = 0; i < nexps; i++)
+  {
+    values[i] = bzla_model_get_value(bzla, exps[i]);
+  }
+}
+
 /*------------------------------------------------------------------------*/
 
 static void
@@ -79,6 +79,56 @@ void bzla_model_get_fun_model(Bzla* bzla,
                               BzlaNodePtrStack* args,
                               BzlaNodePtrStack* values);
 
+/**
+ * Compact representation of an array model.
+ *
+ * Model entries are sorted by index and contiguous indices with the same
+ * value are merged into runs [lower, upper] -> value. Indices that are not
+ * covered by any run map to 'default_value' (0 if the base array is not a
+ * constant array, i.e., if these indices are unconstrained).
+ */
+struct BzlaArrayModelRun
+{
+  BzlaBitVector* lower;
+  BzlaBitVector* upper;
+  BzlaBitVector* value;
+};
+typedef struct BzlaArrayModelRun BzlaArrayModelRun;
+
+struct BzlaArrayModel
+{
+  BzlaBitVector* default_value;
+  uint32_t num_runs;
+  BzlaArrayModelRun* runs;
+};
+typedef struct BzlaArrayModel BzlaArrayModel;
+
+/**
+ * Get compact model of given array term. Returns 0 if the array has no model.
+ * The returned model must be deleted via bzla_model_delete_array_model_compact.
+ */
+BzlaArrayModel* bzla_model_get_array_model_compact(Bzla* bzla, BzlaNode* exp);
+
+void bzla_model_delete_array_model_compact(Bzla* bzla, BzlaArrayModel* model);
+
+/**
+ * Get value of given index in a compact array model (binary search over the
+ * runs). Returns 0 if the index is unconstrained.
+ */
+const BzlaBitVector* bzla_model_array_model_get(const BzlaArrayModel* model,
+                                                const BzlaBitVector* index);
+
+/**
+ * Get model value of array 'exp' at given 'index' without computing the
+ * model of the whole array. The write chain of 'exp' is only traversed down
+ * to the first store that matches 'index', or to the first array that
+ * already has a function model. Returns 0 if the value can not be determined
+ * without beta reduction (non-array lambdas).
+ */
+BzlaBitVector* bzla_model_get_array_value(Bzla* bzla,
+                                          BzlaNode* exp,
+                                          const BzlaBitVector* index);
+
 /**
  * Get node representation of the model value of the given node.
  *
@@ -88,6 +138,18 @@ void bzla_model_get_fun_model(Bzla* bzla,
  */
 BzlaNode* bzla_model_get_value(Bzla* bzla, BzlaNode* exp);
 
+/**
+ * Get node representation of the model values of the given nodes.
+ *
+ * Equivalent to calling bzla_model_get_value on each node, but the model
+ * values of the nodes (and the nodes below them) are computed in a single
+ * traversal.
+ */
+void bzla_model_get_values(Bzla* bzla,
+                           BzlaNode* exps[],
+                           uint32_t nexps,
+                           BzlaNode* values[]);
+
 /*------------------------------------------------------------------------*/
 
 void bzla_model_add_to_bv(Bzla* bzla,
@@ -442,6 +442,17 @@ bzla_opt_init_opts(Bzla *bzla)
            0,
            1,
            "add ackermann constraints");
+  init_opt(bzla,
+           BZLA_OPT_PP_ACKERMANN_LIMIT,
+           true,
+           false,
+           "ackermann-limit",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "max. number of ackermann constraints per function, 0 for no "
+           "limit");
   init_opt(bzla,
            BZLA_OPT_PP_BETA_REDUCE,
            true,
@@ -648,6 +659,28 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "run sls engine as preprocessing within a sequential portfolio "
            "(QF_BV only)");
+  init_opt(bzla,
+           BZLA_OPT_FUN_HYBRID,
+           true,
+           true,
+           "fun-hybrid",
+           0,
+           0,
+           0,
+           1,
+           "interleave preprop/presls engine with bounded SAT calls and "
+           "exchange phases and fixed bits (QF_BV only)");
+  init_opt(bzla,
+           BZLA_OPT_FUN_PREFPLS,
+           true,
+           true,
+           "fun-prefpls",
+           0,
+           0,
+           0,
+           1,
+           "run floating-point level local search as preprocessing step "
+           "(QF_FP only)");
   init_opt(bzla,
            BZLA_OPT_FUN_DUAL_PROP,
            true,
@@ -763,6 +796,12 @@ bzla_opt_init_opts(Bzla *bzla)
                "all",
                BZLA_FUN_EAGER_LEMMAS_ALL,
                "generate lemmas for all conflicts");
+  add_opt_help(mm,
+               opts,
+               "batch",
+               BZLA_FUN_EAGER_LEMMAS_BATCH,
+               "generate lemmas for all congruence, beta reduction and "
+               "extensionality conflicts in one refinement round");
   bzla->options[BZLA_OPT_FUN_EAGER_LEMMAS].options = opts;
 
   init_opt(bzla,
@@ -776,6 +815,51 @@ bzla_opt_init_opts(Bzla *bzla)
            1,
            "represent array store as lambda");
 
+  init_opt(bzla,
+           BZLA_OPT_FUN_WEG,
+           true,
+           false,
+           "fun-weg",
+           0,
+           0,
+           0,
+           1,
+           "propagate over store chains via weak equivalence index");
+
+  init_opt(bzla,
+           BZLA_OPT_FUN_LAZY_MODEL,
+           true,
+           false,
+           "fun-lazy-model",
+           0,
+           0,
+           0,
+           1,
+           "compute model values on demand only");
+
+  init_opt(bzla,
+           BZLA_OPT_FUN_DYNAMIC_ACK,
+           true,
+           false,
+           "fun-dynamic-ack",
+           0,
+           0,
+           0,
+           UINT32_MAX,
+           "number of congruence lemmas per function after which ackermann "
+           "constraints are added eagerly, 0 to disable");
+  init_opt(bzla,
+           BZLA_OPT_FUN_BETA_CACHE,
+           true,
+           true,
+           "fun-beta-cache",
+           0,
+           0,
+           0,
+           1,
+           "cache partial beta reduction results across refinement "
+           "iterations and incremental calls");
+
   /* SLS engine (expert options) -------------------------------------------- */
   init_opt(bzla,
            BZLA_OPT_SLS_NFLIPS,
@@ -1188,6 +1272,17 @@ bzla_opt_init_opts(Bzla *bzla)
            "the enabled branch) for ITE during path selection before "
            "decreasing or increasing the probability for flipping the "
            "condition if either the 'then' or 'else' branch is constant");
+  init_opt(bzla,
+           BZLA_OPT_PROP_FUN,
+           true,
+           true,
+           "prop-fun",
+           0,
+           0,
+           0,
+           1,
+           "enable prop engine for formulas with arrays and uninterpreted "
+           "functions");
   init_opt(bzla,
            BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
            true,
@@ -1598,6 +1693,26 @@ bzla_opt_init_opts(Bzla *bzla)
            UINT32_MAX,
            "interpret sorts introduced with declare-sort as bit-vectors of "
            "given width");
+  init_opt(bzla,
+           BZLA_OPT_FP_LAZY_WORD_BLAST,
+           true,
+           true,
+           "fp-lazy-word-blast",
+           0,
+           0,
+           0,
+           1,
+           "word-blast expensive floating-point operators on demand");
+  init_opt(bzla,
+           BZLA_OPT_FP_WORD_BLAST_TEMPLATES,
+           true,
+           true,
+           "fp-word-blast-templates",
+           0,
+           1,
+           0,
+           1,
+           "cache word-blasting templates of floating-point operators");
   init_opt(bzla,
            BZLA_OPT_SMT_COMP_MODE,
            true,
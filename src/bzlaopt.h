@@ -42,6 +42,7 @@ enum BzlaOption
 
   /* Rewriting/preprocessing (expert) */
   BZLA_OPT_PP_ACKERMANN,
+  BZLA_OPT_PP_ACKERMANN_LIMIT,
   BZLA_OPT_PP_BETA_REDUCE,
   BZLA_OPT_PP_ELIMINATE_EXTRACTS,
   BZLA_OPT_PP_ELIMINATE_ITES,
@@ -66,6 +67,8 @@ enum BzlaOption
 
   BZLA_OPT_FUN_PREPROP,
   BZLA_OPT_FUN_PRESLS,
+  BZLA_OPT_FUN_HYBRID,
+  BZLA_OPT_FUN_PREFPLS,
   BZLA_OPT_FUN_DUAL_PROP,
   BZLA_OPT_FUN_DUAL_PROP_QSORT,
   BZLA_OPT_FUN_JUST,
@@ -73,6 +76,10 @@ enum BzlaOption
   BZLA_OPT_FUN_LAZY_SYNTHESIZE,
   BZLA_OPT_FUN_EAGER_LEMMAS,
   BZLA_OPT_FUN_STORE_LAMBDAS,
+  BZLA_OPT_FUN_WEG,
+  BZLA_OPT_FUN_LAZY_MODEL,
+  BZLA_OPT_FUN_DYNAMIC_ACK,
+  BZLA_OPT_FUN_BETA_CACHE,
 
   /* SLS engine (expert) */
 
@@ -105,6 +112,7 @@ enum BzlaOption
   BZLA_OPT_PROP_ENTAILED,
   BZLA_OPT_PROP_FLIP_COND_CONST_DELTA,
   BZLA_OPT_PROP_FLIP_COND_CONST_NPATHSEL,
+  BZLA_OPT_PROP_FUN,
   BZLA_OPT_PROP_INFER_INEQ_BOUNDS,
   BZLA_OPT_PROP_NO_MOVE_ON_CONFLICT,
   BZLA_OPT_PROP_NPROPS,
@@ -149,6 +157,8 @@ enum BzlaOption
   BZLA_OPT_CHECK_UNCONSTRAINED,
   BZLA_OPT_CHECK_UNSAT_ASSUMPTIONS,
   BZLA_OPT_DECLSORT_BV_WIDTH,
+  BZLA_OPT_FP_LAZY_WORD_BLAST,
+  BZLA_OPT_FP_WORD_BLAST_TEMPLATES,
   BZLA_OPT_LS_SHARE_SAT,
   BZLA_OPT_PARSE_INTERACTIVE,
   BZLA_OPT_SAT_ENGINE_CADICAL_FREEZE,
@@ -280,6 +290,7 @@ enum BzlaOptFunEagerLemmas
   BZLA_FUN_EAGER_LEMMAS_NONE,
   BZLA_FUN_EAGER_LEMMAS_CONF,
   BZLA_FUN_EAGER_LEMMAS_ALL,
+  BZLA_FUN_EAGER_LEMMAS_BATCH,
 };
 typedef enum BzlaOptFunEagerLemmas BzlaOptFunEagerLemmas;
 
@@ -404,7 +415,7 @@ extern const char *const g_bzla_se_name[BZLA_SAT_ENGINE_MAX + 1];
 #define BZLA_QUANT_SYNTH_DFLT BZLA_QUANT_SYNTH_ELMR
 
 #define BZLA_FUN_EAGER_LEMMAS_MIN BZLA_FUN_EAGER_LEMMAS_NONE
-#define BZLA_FUN_EAGER_LEMMAS_MAX BZLA_FUN_EAGER_LEMMAS_ALL
+#define BZLA_FUN_EAGER_LEMMAS_MAX BZLA_FUN_EAGER_LEMMAS_BATCH
 #define BZLA_FUN_EAGER_LEMMAS_DFLT BZLA_FUN_EAGER_LEMMAS_CONF
 
 #define BZLA_BETA_REDUCE_MIN BZLA_BETA_REDUCE_NONE
@@ -117,6 +117,12 @@ melt(BzlaSATMgr *smgr, int32_t lit)
   // TODO: else case warning?
 }
 
+static inline void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  if (smgr->api.phase) smgr->api.phase(smgr, lit);
+}
+
 static inline int32_t
 repr(BzlaSATMgr *smgr, int32_t lit)
 {
@@ -191,6 +197,13 @@ bzla_sat_mgr_has_incremental_support(const BzlaSATMgr *smgr)
   return smgr->api.assume != 0 && smgr->api.failed != 0;
 }
 
+bool
+bzla_sat_mgr_has_phase_support(const BzlaSATMgr *smgr)
+{
+  if (!smgr) return false;
+  return smgr->api.phase != 0;
+}
+
 void
 bzla_sat_mgr_set_term(BzlaSATMgr *smgr, int32_t (*fun)(void *), void *state)
 {
@@ -465,6 +478,15 @@ bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit)
   return res;
 }
 
+void
+bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  assert(smgr != NULL);
+  assert(smgr->initialized);
+  assert(abs(lit) <= smgr->maxvar);
+  phase(smgr, lit);
+}
+
 /*------------------------------------------------------------------------*/
 
 void
@@ -562,6 +584,13 @@ dimacs_printer_fixed(BzlaSATMgr *smgr, int32_t lit)
   return fixed(printer->smgr, lit);
 }
 
+static void
+dimacs_printer_phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  BzlaCnfPrinter *printer = (BzlaCnfPrinter *) smgr->solver;
+  phase(printer->smgr, lit);
+}
+
 static void
 dimacs_printer_reset(BzlaSATMgr *smgr)
 {
@@ -752,6 +781,7 @@ enable_dimacs_printer(BzlaSATMgr *smgr)
   smgr->api.assume = printer->smgr->api.assume ? dimacs_printer_assume : 0;
   smgr->api.failed = printer->smgr->api.failed ? dimacs_printer_failed : 0;
   smgr->api.clone  = printer->smgr->api.clone ? dimacs_printer_clone : 0;
+  smgr->api.phase  = printer->smgr->api.phase ? dimacs_printer_phase : 0;
 
   return true;
 }
@@ -66,6 +66,7 @@ struct BzlaSATMgr
     int32_t (*inc_max_var)(BzlaSATMgr *);
     void *(*init)(BzlaSATMgr *); /* required */
     void (*melt)(BzlaSATMgr *, int32_t);
+    void (*phase)(BzlaSATMgr *, int32_t);
     int32_t (*repr)(BzlaSATMgr *, int32_t);
     void (*reset)(BzlaSATMgr *);           /* required */
     int32_t (*sat)(BzlaSATMgr *, int32_t); /* required */
@@ -100,6 +101,8 @@ bool bzla_sat_mgr_has_clone_support(const BzlaSATMgr *smgr);
 
 bool bzla_sat_mgr_has_incremental_support(const BzlaSATMgr *smgr);
 
+bool bzla_sat_mgr_has_phase_support(const BzlaSATMgr *smgr);
+
 void bzla_sat_mgr_set_term(BzlaSATMgr *smgr,
                            int32_t (*fun)(void *),
                            void *state);
@@ -152,7 +155,9 @@ void bzla_sat_assume(BzlaSATMgr *smgr, int32_t lit);
 int32_t bzla_sat_failed(BzlaSATMgr *smgr, int32_t lit);
 
 /* Solves the SAT instance.
- * limit < 0 -> no limit.
+ * limit < 0 -> no limit, else the SAT call is bounded by 'limit' conflicts
+ * (decisions for PicoSAT) and returns unknown if the limit is reached.
+ * The limit is ignored by SAT solvers that do not support limits.
  */
 BzlaSolverResult bzla_sat_check_sat(BzlaSATMgr *smgr, int32_t limit);
 
@@ -174,6 +179,12 @@ int32_t bzla_sat_repr(BzlaSATMgr *smgr, int32_t lit);
  */
 int32_t bzla_sat_fixed(BzlaSATMgr *smgr, int32_t lit);
 
+/* Sets the preferred phase of the variable of given literal for the next
+ * decisions of the SAT solver (lit > 0 -> true, lit < 0 -> false).
+ * This is only a hint and ignored if the SAT solver does not support it.
+ */
+void bzla_sat_phase(BzlaSATMgr *smgr, int32_t lit);
+
 /* Resets the status of the SAT solver. */
 void bzla_sat_reset(BzlaSATMgr *smgr);
 
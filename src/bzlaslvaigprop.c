@@ -72,7 +72,7 @@ get_assignment_aig(BzlaAIGProp *aprop, BzlaAIG *aig)
   if (aig == BZLA_AIG_TRUE) return 1;
   if (aig == BZLA_AIG_FALSE) return -1;
   /* initialize don't care bits with false */
-  if (!bzla_hashint_map_contains(aprop->model, BZLA_REAL_ADDR_AIG(aig)->id))
+  if (!bzla_aigprop_has_assignment_aig(aprop, aig))
     return BZLA_IS_INVERTED_AIG(aig) ? 1 : -1;
   return bzla_aigprop_get_assignment_aig(aprop, aig);
 }
@@ -239,7 +239,6 @@ sat_aigprop_solver(BzlaAIGPropSolver *slv)
 
   assert(slv->aprop);
   assert(!slv->aprop->roots);
-  assert(!slv->aprop->score);
   assert(!slv->aprop->model);
   slv->aprop->loglevel     = bzla_opt_get(bzla, BZLA_OPT_LOGLEVEL);
   slv->aprop->seed         = bzla_opt_get(bzla, BZLA_OPT_SEED);
@@ -274,21 +273,14 @@ sat_aigprop_solver(BzlaAIGPropSolver *slv)
   sat_result = BZLA_RESULT_SAT;
   generate_model_from_aig_model(bzla);
 DONE:
-  slv->stats.moves                  = slv->aprop->stats.moves;
-  slv->stats.props                  = slv->aprop->stats.props;
-  slv->stats.restarts               = slv->aprop->stats.restarts;
-  slv->time.aprop_sat               = slv->aprop->time.sat;
-  slv->time.aprop_update_cone       = slv->aprop->time.update_cone;
-  slv->time.aprop_update_cone_reset = slv->aprop->time.update_cone_reset;
-  slv->time.aprop_update_cone_model_gen =
-      slv->aprop->time.update_cone_model_gen;
-  slv->time.aprop_update_cone_compute_score =
-      slv->aprop->time.update_cone_compute_score;
-  if (slv->aprop->model)
-  {
-    bzla_hashint_map_delete(slv->aprop->model);
-    slv->aprop->model = 0;
-  }
+  slv->stats.moves            = slv->aprop->stats.moves;
+  slv->stats.props            = slv->aprop->stats.props;
+  slv->stats.restarts         = slv->aprop->stats.restarts;
+  slv->stats.updates          = slv->aprop->stats.updates;
+  slv->time.aprop_sat         = slv->aprop->time.sat;
+  slv->time.aprop_init        = slv->aprop->time.init;
+  slv->time.aprop_update_cone = slv->aprop->time.update_cone;
+  bzla_aigprop_delete_model(slv->aprop);
   if (roots) bzla_hashint_table_delete(roots);
   return sat_result;
 }
@@ -314,6 +306,7 @@ print_stats_aigprop_solver(BzlaAIGPropSolver *slv)
       "moves per second: %.2f",
       slv->stats.moves ? (double) slv->stats.moves / slv->time.aprop_sat : 0.0);
   BZLA_MSG(bzla->msg, 1, "props: %d", slv->stats.props);
+  BZLA_MSG(bzla->msg, 1, "cone updates: %lld", slv->stats.updates);
   BZLA_MSG(
       bzla->msg,
       1,
@@ -335,21 +328,12 @@ print_time_stats_aigprop_solver(BzlaAIGPropSolver *slv)
   BZLA_MSG(bzla->msg, 1, "");
   BZLA_MSG(bzla->msg,
            1,
-           "%.2f seconds for updating cone (total)",
-           slv->time.aprop_update_cone);
-  BZLA_MSG(bzla->msg,
-           1,
-           "%.2f seconds for updating cone (reset)",
-           slv->time.aprop_update_cone_reset);
+           "%.2f seconds for building flat AIG representation",
+           slv->time.aprop_init);
   BZLA_MSG(bzla->msg,
            1,
-           "%.2f seconds for updating cone (model gen)",
-           slv->time.aprop_update_cone_model_gen);
-  if (bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
-    BZLA_MSG(bzla->msg,
-             1,
-             "%.2f seconds for updating cone (compute score)",
-             slv->time.aprop_update_cone_compute_score);
+           "%.2f seconds for updating cone",
+           slv->time.aprop_update_cone);
   BZLA_MSG(bzla->msg, 1, "");
 }
 
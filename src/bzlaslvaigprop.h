@@ -28,14 +28,13 @@ struct BzlaAIGPropSolver
     uint32_t moves;
     uint64_t props;
     uint32_t restarts;
+    uint64_t updates;
   } stats;
   struct
   {
     double aprop_sat;
+    double aprop_init;
     double aprop_update_cone;
-    double aprop_update_cone_reset;
-    double aprop_update_cone_model_gen;
-    double aprop_update_cone_compute_score;
   } time;
 };
 
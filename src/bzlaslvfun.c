@@ -10,12 +10,16 @@
 
 #include "bzlaslvfun.h"
 
+#include <inttypes.h>
+
 #include "bzlabeta.h"
 #include "bzlaclone.h"
 #include "bzlacore.h"
 #include "bzladbg.h"
 #include "bzladcr.h"
 #include "bzlaexp.h"
+#include "bzlafp.h"
+#include "bzlafpls.h"
 #include "bzlalog.h"
 #include "bzlalsutils.h"
 #include "bzlamodel.h"
@@ -23,6 +27,7 @@
 #include "bzlaprintmodel.h"
 #include "bzlaslvprop.h"
 #include "bzlaslvsls.h"
+#include "preprocess/bzlaack.h"
 #include "preprocess/bzlapreprocess.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlahash.h"
@@ -35,6 +40,22 @@
 
 /*------------------------------------------------------------------------*/
 
+/* Initial limits for hybrid mode (BZLA_OPT_FUN_HYBRID), doubled every round.
+ * Number of local search steps (propagations for prop, flips for sls). */
+#define BZLA_FUN_HYBRID_LS_LIMIT_INIT 10000
+/* Number of conflicts for the SAT solver. */
+#define BZLA_FUN_HYBRID_SAT_LIMIT_INIT 1000
+
+/* Maximum number of moves of the floating-point local search pre-pass
+ * (BZLA_OPT_FUN_PREFPLS). */
+#define BZLA_FUN_FPLS_MAX_MOVES 10000
+
+/*------------------------------------------------------------------------*/
+
+static void delete_dual_prop_clone(BzlaFunSolver *slv);
+
+/*------------------------------------------------------------------------*/
+
 static BzlaFunSolver *
 clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
 {
@@ -43,7 +64,7 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
   assert(slv->kind == BZLA_FUN_SOLVER_KIND);
   assert(exp_map);
 
-  uint32_t h;
+  uint32_t h, i;
   Bzla *bzla;
   BzlaFunSolver *res;
 
@@ -52,8 +73,9 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
   BZLA_NEW(clone->mm, res);
   memcpy(res, slv, sizeof(BzlaFunSolver));
 
-  res->bzla   = clone;
-  res->lemmas = bzla_hashptr_table_clone(
+  res->bzla       = clone;
+  res->beta_cache = bzla_beta_cache_new(clone);
+  res->lemmas     = bzla_hashptr_table_clone(
       clone->mm, slv->lemmas, bzla_clone_key_as_node, 0, exp_map, 0);
 
   bzla_clone_node_ptr_stack(
@@ -62,6 +84,16 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
   bzla_clone_node_ptr_stack(
       clone->mm, &slv->constraints, &res->constraints, exp_map, false);
 
+  res->ack_lemmas = bzla_hashint_map_clone(
+      clone->mm, slv->ack_lemmas, bzla_clone_data_as_int, 0);
+
+  if (slv->score_visited)
+    res->score_visited =
+        bzla_hashint_table_clone(clone->mm, slv->score_visited);
+
+  /* the dual prop clone is not cloned but recreated on demand */
+  memset(&res->dp, 0, sizeof(res->dp));
+
   if (slv->score)
   {
     h = bzla_opt_get(bzla, BZLA_OPT_FUN_JUST_HEURISTIC);
@@ -86,6 +118,13 @@ clone_fun_solver(Bzla *clone, BzlaFunSolver *slv, BzlaNodeMap *exp_map)
     }
   }
 
+  BZLA_INIT_STACK(clone->mm, res->stats.lemmas_per_round);
+  for (i = 0; i < BZLA_COUNT_STACK(slv->stats.lemmas_per_round); i++)
+  {
+    BZLA_PUSH_STACK(res->stats.lemmas_per_round,
+                    BZLA_PEEK_STACK(slv->stats.lemmas_per_round, i));
+  }
+
   BZLA_INIT_STACK(clone->mm, res->stats.lemmas_size);
   if (BZLA_SIZE_STACK(slv->stats.lemmas_size) > 0)
   {
@@ -151,6 +190,10 @@ delete_fun_solver(BzlaFunSolver *slv)
     }
     bzla_hashptr_table_delete(slv->score);
   }
+  if (slv->score_visited) bzla_hashint_table_delete(slv->score_visited);
+
+  bzla_hashint_map_delete(slv->ack_lemmas);
+  delete_dual_prop_clone(slv);
 
   BZLA_RELEASE_STACK(slv->cur_lemmas);
   while (!BZLA_EMPTY_STACK(slv->constraints))
@@ -159,6 +202,8 @@ delete_fun_solver(BzlaFunSolver *slv)
   }
   BZLA_RELEASE_STACK(slv->constraints);
   BZLA_RELEASE_STACK(slv->stats.lemmas_size);
+  BZLA_RELEASE_STACK(slv->stats.lemmas_per_round);
+  bzla_beta_cache_delete(slv->beta_cache);
   BZLA_DELETE(bzla->mm, slv);
   bzla->slv = 0;
 }
@@ -238,7 +283,11 @@ configure_sat_mgr(Bzla *bzla)
   /* reset SAT solver to non-incremental if all functions have been
    * eliminated */
   if (!bzla_opt_get(bzla, BZLA_OPT_INCREMENTAL) && smgr->inc_required
-      && !incremental_required(bzla))
+      && !incremental_required(bzla)
+      /* hybrid mode requires multiple SAT calls */
+      && !(bzla_opt_get(bzla, BZLA_OPT_FUN_HYBRID)
+           && (bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP)
+               || bzla_opt_get(bzla, BZLA_OPT_FUN_PRESLS))))
   {
     smgr->inc_required = false;
     BZLA_MSG(bzla->msg,
@@ -346,30 +395,45 @@ get_bv_assignment(Bzla *bzla, BzlaNode *exp)
 
 /*------------------------------------------------------------------------*/
 
-static Bzla *
-new_exp_layer_clone_for_dual_prop(Bzla *bzla,
-                                  BzlaNodeMap **exp_map,
-                                  BzlaNode **root)
+static void
+delete_dual_prop_clone(BzlaFunSolver *slv)
+{
+  assert(slv);
+
+  Bzla *clone;
+  BzlaIntHashTableIterator it;
+
+  clone = slv->dp.clone;
+  if (!clone) return;
+
+  if (slv->dp.root) bzla_node_release(clone, slv->dp.root);
+  bzla_iter_hashint_init(&it, slv->dp.node_map);
+  while (bzla_iter_hashint_has_next(&it))
+    bzla_node_release(clone, bzla_iter_hashint_next_data(&it)->as_ptr);
+  bzla_hashint_map_delete(slv->dp.node_map);
+  bzla_hashint_table_delete(slv->dp.synced);
+  bzla_delete(clone);
+  memset(&slv->dp, 0, sizeof(slv->dp));
+}
+
+static void
+new_exp_layer_clone_for_dual_prop(Bzla *bzla, BzlaNodeMap **exp_map)
 {
   assert(bzla);
   assert(bzla->slv);
   assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
   assert(exp_map);
-  assert(root);
 
-  double start;
   Bzla *clone;
-  BzlaNode *cur, *and;
+  BzlaFunSolver *slv;
   BzlaPtrHashTableIterator it;
 
-  /* empty formula */
-  if (bzla->unsynthesized_constraints->count == 0) return 0;
+  slv = BZLA_FUN_SOLVER(bzla);
+  assert(!slv->dp.clone);
 
-  start = bzla_util_time_stamp();
   clone = bzla_clone_exp_layer(bzla, exp_map, true);
   assert(!clone->synthesized_constraints->count);
   assert(clone->embedded_constraints->count == 0);
-  assert(clone->unsynthesized_constraints->count);
 
   bzla_opt_set(clone, BZLA_OPT_PRODUCE_MODELS, 0);
   bzla_opt_set(clone, BZLA_OPT_INCREMENTAL, 1);
@@ -381,28 +445,14 @@ new_exp_layer_clone_for_dual_prop(Bzla *bzla,
   bzla_opt_set_str(clone, BZLA_OPT_SAT_ENGINE, "plain=1");
   configure_sat_mgr(clone);
 
+  /* constraints and assumptions are conjoined to the root via 'exp_map' */
   bzla_iter_hashptr_init(&it, clone->unsynthesized_constraints);
   bzla_iter_hashptr_queue(&it, clone->assumptions);
   while (bzla_iter_hashptr_has_next(&it))
   {
-    cur                                  = bzla_iter_hashptr_next(&it);
-    bzla_node_real_addr(cur)->constraint = 0;
-    if (!*root)
-    {
-      *root = bzla_node_copy(clone, cur);
-    }
-    else
-    {
-      and = bzla_exp_bv_and(clone, *root, cur);
-      bzla_node_release(clone, *root);
-      *root = and;
-    }
-  }
-
-  bzla_iter_hashptr_init(&it, clone->unsynthesized_constraints);
-  bzla_iter_hashptr_queue(&it, clone->assumptions);
-  while (bzla_iter_hashptr_has_next(&it))
+    bzla_node_real_addr(it.bucket->key)->constraint = 0;
     bzla_node_release(clone, bzla_iter_hashptr_next(&it));
+  }
   bzla_hashptr_table_delete(clone->unsynthesized_constraints);
   bzla_hashptr_table_delete(clone->assumptions);
   clone->unsynthesized_constraints =
@@ -414,8 +464,192 @@ new_exp_layer_clone_for_dual_prop(Bzla *bzla,
                              (BzlaHashPtr) bzla_node_hash_by_id,
                              (BzlaCmpPtr) bzla_node_compare_by_id);
 
-  BZLA_FUN_SOLVER(bzla)->time.search_init_apps_cloning +=
-      bzla_util_time_stamp() - start;
+  slv->dp.clone    = clone;
+  slv->dp.root     = 0;
+  slv->dp.node_map = bzla_hashint_map_new(clone->mm);
+  slv->dp.synced   = bzla_hashint_table_new(clone->mm);
+  slv->stats.dp_clones++;
+}
+
+/**
+ * Save the node mapping 'exp_map' of the dual propagation clone as mapping
+ * of node ids to clone nodes and delete 'exp_map'. This does not keep the
+ * nodes of 'bzla' alive across sat calls.
+ */
+static void
+save_dual_prop_map(BzlaFunSolver *slv, BzlaNodeMap *exp_map)
+{
+  assert(slv);
+  assert(slv->dp.clone);
+  assert(exp_map);
+
+  BzlaNode *cur;
+  BzlaNodeMapIterator it;
+  BzlaIntHashTableIterator iit;
+
+  bzla_iter_hashint_init(&iit, slv->dp.node_map);
+  while (bzla_iter_hashint_has_next(&iit))
+    bzla_node_release(slv->dp.clone, bzla_iter_hashint_next_data(&iit)->as_ptr);
+  bzla_hashint_map_delete(slv->dp.node_map);
+  slv->dp.node_map = bzla_hashint_map_new(slv->dp.clone->mm);
+
+  bzla_iter_nodemap_init(&it, exp_map);
+  while (bzla_iter_nodemap_has_next(&it))
+  {
+    cur = it.it.bucket->data.as_ptr;
+    assert(bzla_node_real_addr(cur)->bzla == slv->dp.clone);
+    bzla_hashint_map_add(slv->dp.node_map,
+                         bzla_node_get_id(bzla_iter_nodemap_next(&it)))
+        ->as_ptr = bzla_node_copy(slv->dp.clone, cur);
+  }
+  bzla_nodemap_delete(exp_map);
+}
+
+/**
+ * Restore the node mapping of the dual propagation clone for all nodes of
+ * 'bzla' that still exist.
+ */
+static BzlaNodeMap *
+restore_dual_prop_map(Bzla *bzla)
+{
+  assert(bzla);
+
+  int32_t id;
+  BzlaNode *cur, *cur_clone;
+  BzlaNodeMap *res;
+  BzlaFunSolver *slv;
+  BzlaIntHashTableIterator it;
+
+  slv = BZLA_FUN_SOLVER(bzla);
+  assert(slv->dp.clone);
+
+  res = bzla_nodemap_new(bzla);
+  bzla_iter_hashint_init(&it, slv->dp.node_map);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    cur_clone = slv->dp.node_map->data[it.cur_pos].as_ptr;
+    id        = bzla_iter_hashint_next(&it);
+    assert(id > 0);
+    /* skip nodes that were released or substituted in the meantime */
+    cur = bzla_node_get_by_id(bzla, id);
+    if (!cur || bzla_node_is_proxy(cur)) continue;
+    bzla_nodemap_map(res, cur, cur_clone);
+  }
+  return res;
+}
+/**
+ * Return true if all constraints conjoined to the root of the dual
+ * propagation clone are still constraints of 'bzla', i.e., if they were
+ * not simplified or substituted since the last sat call.
+ */
+static bool
+is_valid_dual_prop_clone(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t num_synced = 0;
+  BzlaFunSolver *slv;
+  BzlaPtrHashTableIterator it;
+
+  slv = BZLA_FUN_SOLVER(bzla);
+  assert(slv->dp.clone);
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    if (bzla_hashint_table_contains(
+            slv->dp.synced, bzla_node_get_id(bzla_iter_hashptr_next(&it))))
+      num_synced++;
+  }
+  return num_synced == slv->dp.synced->count;
+}
+
+/**
+ * Get the dual propagation clone for the current sat call and the root of
+ * the negated formula (constraints, lemmas and assumptions). The clone is
+ * created on the first call (or if it became invalid) and otherwise only
+ * updated with the constraints added since the last sat call.
+ */
+static Bzla *
+get_dual_prop_clone(Bzla *bzla, BzlaNodeMap **exp_map, BzlaNode **root)
+{
+  assert(bzla);
+  assert(bzla->slv);
+  assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
+  assert(exp_map);
+  assert(root);
+
+  double start;
+  Bzla *clone;
+  BzlaNode *cur, *ccur, *and;
+  BzlaFunSolver *slv;
+  BzlaPtrHashTableIterator it;
+
+  slv = BZLA_FUN_SOLVER(bzla);
+
+  /* empty formula */
+  if (bzla->unsynthesized_constraints->count == 0
+      && bzla->synthesized_constraints->count == 0
+      && bzla->assumptions->count == 0)
+    return 0;
+
+  start = bzla_util_time_stamp();
+
+  if (slv->dp.clone && !is_valid_dual_prop_clone(bzla))
+    delete_dual_prop_clone(slv);
+
+  if (slv->dp.clone)
+    *exp_map = restore_dual_prop_map(bzla);
+  else
+    new_exp_layer_clone_for_dual_prop(bzla, exp_map);
+  clone = slv->dp.clone;
+
+  /* conjoin new constraints */
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur = bzla_iter_hashptr_next(&it);
+    if (bzla_hashint_table_contains(slv->dp.synced, bzla_node_get_id(cur)))
+      continue;
+    bzla_hashint_table_add(slv->dp.synced, bzla_node_get_id(cur));
+    ccur = bzla_clone_recursively_rebuild_exp(bzla, clone, cur, *exp_map, 0);
+    if (!slv->dp.root)
+    {
+      slv->dp.root = ccur;
+    }
+    else
+    {
+      and = bzla_exp_bv_and(clone, slv->dp.root, ccur);
+      bzla_node_release(clone, slv->dp.root);
+      bzla_node_release(clone, ccur);
+      slv->dp.root = and;
+    }
+  }
+
+  /* assumptions are only conjoined to the root of the current sat call */
+  *root = slv->dp.root ? bzla_node_copy(clone, slv->dp.root) : 0;
+  bzla_iter_hashptr_init(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    cur  = bzla_iter_hashptr_next(&it);
+    ccur = bzla_clone_recursively_rebuild_exp(bzla, clone, cur, *exp_map, 0);
+    if (!*root)
+    {
+      *root = ccur;
+    }
+    else
+    {
+      and = bzla_exp_bv_and(clone, *root, ccur);
+      bzla_node_release(clone, *root);
+      bzla_node_release(clone, ccur);
+      *root = and;
+    }
+  }
+  assert(*root);
+
+  slv->time.search_init_apps_cloning += bzla_util_time_stamp() - start;
   return clone;
 }
 
@@ -931,15 +1165,33 @@ add_lemma_to_dual_prop_clone(Bzla *bzla,
   assert(lemma);
 
   BzlaNode *clemma, *and;
+  BzlaFunSolver *slv;
 
   /* clone and rebuild lemma with rewrite level 0 (as we want the exact
    * expression) */
   clemma = bzla_clone_recursively_rebuild_exp(bzla, clone, lemma, exp_map, 0);
   assert(clemma);
   and = bzla_exp_bv_and(clone, *root, clemma);
-  bzla_node_release(clone, clemma);
   bzla_node_release(clone, *root);
   *root = and;
+
+  /* lemmas are kept in the persistent root */
+  slv = BZLA_FUN_SOLVER(bzla);
+  assert(slv->dp.clone == clone);
+  if (!slv->assume_lemmas)
+  {
+    if (!slv->dp.root)
+    {
+      slv->dp.root = bzla_node_copy(clone, clemma);
+    }
+    else
+    {
+      and = bzla_exp_bv_and(clone, slv->dp.root, clemma);
+      bzla_node_release(clone, slv->dp.root);
+      slv->dp.root = and;
+    }
+  }
+  bzla_node_release(clone, clemma);
 }
 
 /*------------------------------------------------------------------------*/
@@ -1448,6 +1700,28 @@ mk_premise(Bzla *bzla, BzlaNode *args, BzlaNode *prem[], uint32_t num_prem)
   return res;
 }
 
+/* Partial beta reduction of lambda 'fun' w.r.t. 'args', evaluated conditions
+ * are collected in 'conds' (if given). Results are cached across refinement
+ * iterations and sat calls if BZLA_OPT_FUN_BETA_CACHE is enabled. */
+static BzlaNode *
+beta_reduce_partial(Bzla *bzla,
+                    BzlaNode *fun,
+                    BzlaNode *args,
+                    BzlaPtrHashTable *conds)
+{
+  BzlaNode *res;
+
+  if (bzla_opt_get(bzla, BZLA_OPT_FUN_BETA_CACHE))
+  {
+    return bzla_beta_reduce_partial_cached(
+        bzla, fun, args, conds, BZLA_FUN_SOLVER(bzla)->beta_cache);
+  }
+  bzla_beta_assign_args(bzla, fun, args);
+  res = bzla_beta_reduce_partial(bzla, fun, conds);
+  bzla_beta_unassign_params(bzla, fun);
+  return res;
+}
+
 static void
 add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
 {
@@ -1510,9 +1784,7 @@ add_lemma(Bzla *bzla, BzlaNode *fun, BzlaNode *app1, BzlaNode *app2)
   {
     assert(bzla_node_is_lambda(fun));
 
-    bzla_beta_assign_args(bzla, fun, app1->e[1]);
-    value = bzla_beta_reduce_partial(bzla, fun, 0);
-    bzla_beta_unassign_params(bzla, fun);
+    value = beta_reduce_partial(bzla, fun, app1->e[1], 0);
     assert(!bzla_node_is_lambda(value));
 
     /* path from conflicting fun to value */
@@ -1666,6 +1938,309 @@ find_conflict_app(Bzla *bzla, BzlaNode *app, BzlaIntHashTable *conf_apps)
   return res;
 }
 
+/*------------------------------------------------------------------------*/
+
+/* Weak equivalence index over store chains (BZLA_OPT_FUN_WEG).
+ *
+ * Stores (update nodes) form a forest via their array child e[0], rooted at
+ * the first non-update function below a chain (the base). For the current
+ * model, the index maps each index value to the stores that write it, and
+ * each store to its depth and its 2^j-th store below (binary lifting).
+ * Propagating a read down a store chain is then a lookup of the nearest
+ * store below with the same index value (or the base if there is none)
+ * instead of a step per store. The index is only valid for one propagation
+ * round since it depends on the current model. */
+
+struct BzlaFunWEGStore
+{
+  uint32_t depth; /* number of stores from the base up to this store */
+  BzlaNode *base; /* first non-update function of the chain */
+  uint32_t nup;
+  BzlaNode **up; /* up[j] = 2^j-th store below this store */
+};
+typedef struct BzlaFunWEGStore BzlaFunWEGStore;
+
+struct BzlaFunWEG
+{
+  BzlaMemMgr *mm;
+  BzlaIntHashTable *stores;  /* maps store id to BzlaFunWEGStore */
+  BzlaPtrHashTable *indices; /* maps index value to stack of stores */
+};
+typedef struct BzlaFunWEG BzlaFunWEG;
+
+static BzlaFunWEG *
+weg_new(BzlaMemMgr *mm)
+{
+  BzlaFunWEG *res;
+
+  BZLA_CNEW(mm, res);
+  res->mm      = mm;
+  res->stores  = bzla_hashint_map_new(mm);
+  res->indices = bzla_hashptr_table_new(mm,
+                                        (BzlaHashPtr) hash_args_assignment,
+                                        (BzlaCmpPtr) compare_args_assignments);
+  return res;
+}
+
+static void
+weg_delete(BzlaFunWEG *weg)
+{
+  BzlaMemMgr *mm;
+  BzlaFunWEGStore *s;
+  BzlaNodePtrStack *stack;
+  BzlaIntHashTableIterator iit;
+  BzlaPtrHashTableIterator pit;
+
+  mm = weg->mm;
+  bzla_iter_hashint_init(&iit, weg->stores);
+  while (bzla_iter_hashint_has_next(&iit))
+  {
+    s = bzla_iter_hashint_next_data(&iit)->as_ptr;
+    BZLA_DELETEN(mm, s->up, s->nup);
+    BZLA_DELETE(mm, s);
+  }
+  bzla_hashint_map_delete(weg->stores);
+  bzla_iter_hashptr_init(&pit, weg->indices);
+  while (bzla_iter_hashptr_has_next(&pit))
+  {
+    stack = pit.bucket->data.as_ptr;
+    (void) bzla_iter_hashptr_next(&pit);
+    BZLA_RELEASE_STACK(*stack);
+    BZLA_DELETE(mm, stack);
+  }
+  bzla_hashptr_table_delete(weg->indices);
+  BZLA_DELETE(mm, weg);
+}
+
+static BzlaFunWEGStore *
+weg_get_store(BzlaFunWEG *weg, BzlaNode *store)
+{
+  BzlaHashTableData *d;
+
+  d = bzla_hashint_map_get(weg->stores, store->id);
+  assert(d);
+  return d->as_ptr;
+}
+
+/* Add all stores below 'store' (including 'store') that are not yet indexed
+ * to the index. Applies in the index and value of newly indexed stores are
+ * pushed for propagation, since their assignments are implicitly used when
+ * skipping stores. */
+static void
+weg_add(Bzla *bzla,
+        BzlaFunWEG *weg,
+        BzlaNode *store,
+        BzlaNodePtrStack *prop_stack,
+        BzlaIntHashTable *apply_search_cache)
+{
+  assert(bzla_node_is_regular(store));
+  assert(bzla_node_is_update(store));
+
+  uint32_t depth, nup, j;
+  BzlaNode *cur, *below, *base;
+  BzlaNodePtrStack path, *stack;
+  BzlaFunWEGStore *s, *t;
+  BzlaPtrHashBucket *b;
+  BzlaMemMgr *mm;
+
+  mm = weg->mm;
+  BZLA_INIT_STACK(mm, path);
+
+  cur = store;
+  while (bzla_node_is_update(cur)
+         && !bzla_hashint_map_contains(weg->stores, cur->id))
+  {
+    BZLA_PUSH_STACK(path, cur);
+    cur = bzla_node_get_simplified(bzla, cur->e[0]);
+  }
+
+  if (bzla_node_is_update(cur))
+  {
+    s     = weg_get_store(weg, cur);
+    depth = s->depth;
+    base  = s->base;
+    below = cur;
+  }
+  else
+  {
+    depth = 0;
+    base  = cur;
+    below = 0;
+  }
+
+  while (!BZLA_EMPTY_STACK(path))
+  {
+    cur = BZLA_POP_STACK(path);
+    depth += 1;
+
+    /* number of valid jumps: floor(log2(depth - 1)) + 1 */
+    nup = 0;
+    while ((1u << nup) <= depth - 1) nup++;
+    BZLA_CNEW(mm, s);
+    s->depth = depth;
+    s->base  = base;
+    s->nup   = nup;
+    if (nup)
+    {
+      BZLA_NEWN(mm, s->up, nup);
+      s->up[0] = below;
+      for (j = 1; j < nup; j++)
+      {
+        t        = weg_get_store(weg, s->up[j - 1]);
+        s->up[j] = t->up[j - 1];
+      }
+    }
+    bzla_hashint_map_add(weg->stores, cur->id)->as_ptr = s;
+
+    b = bzla_hashptr_table_get(weg->indices, cur->e[1]);
+    if (!b)
+    {
+      BZLA_NEW(mm, stack);
+      BZLA_INIT_STACK(mm, *stack);
+      b              = bzla_hashptr_table_add(weg->indices, cur->e[1]);
+      b->data.as_ptr = stack;
+    }
+    stack = b->data.as_ptr;
+    BZLA_PUSH_STACK(*stack, cur);
+
+    push_applies_for_propagation(
+        bzla, cur->e[1], prop_stack, apply_search_cache);
+    push_applies_for_propagation(
+        bzla, cur->e[2], prop_stack, apply_search_cache);
+    below = cur;
+  }
+  BZLA_RELEASE_STACK(path);
+}
+
+/* Return true if 'store' is 'cur' or a store below 'cur'. */
+static bool
+weg_is_below(BzlaFunWEG *weg, BzlaNode *store, BzlaNode *cur)
+{
+  uint32_t j, diff;
+  BzlaFunWEGStore *s, *c;
+
+  s = weg_get_store(weg, store);
+  c = weg_get_store(weg, cur);
+  if (s->depth > c->depth || s->base != c->base) return false;
+  diff = c->depth - s->depth;
+  for (j = 0; diff; j++, diff >>= 1)
+  {
+    if (!(diff & 1)) continue;
+    assert(j < c->nup);
+    cur = c->up[j];
+    c   = weg_get_store(weg, cur);
+  }
+  return cur == store;
+}
+
+/* Find the nearest store at or below 'store' that writes index value 'args'
+ * and return it. If there is no such store, return the base of the chain. */
+static BzlaNode *
+weg_find(BzlaFunWEG *weg, BzlaNode *store, BzlaNode *args)
+{
+  uint32_t i;
+  BzlaNode *res, *cur;
+  BzlaNodePtrStack *stack;
+  BzlaPtrHashBucket *b;
+
+  res = 0;
+  b   = bzla_hashptr_table_get(weg->indices, args);
+  if (b)
+  {
+    stack = b->data.as_ptr;
+    for (i = 0; i < BZLA_COUNT_STACK(*stack); i++)
+    {
+      cur = BZLA_PEEK_STACK(*stack, i);
+      if (res
+          && weg_get_store(weg, cur)->depth <= weg_get_store(weg, res)->depth)
+        continue;
+      if (weg_is_below(weg, cur, store)) res = cur;
+    }
+  }
+  return res ? res : weg_get_store(weg, store)->base;
+}
+
+/**
+ * Count function congruence lemmas for uninterpreted function 'uf' and
+ * switch 'uf' to eager Ackermannization once the number of lemmas reaches
+ * BZLA_OPT_FUN_DYNAMIC_ACK. The Ackermann constraints for all applications
+ * of 'uf' are added as lemmas, unless their number exceeds the cost limit
+ * BZLA_OPT_PP_ACKERMANN_LIMIT, in which case 'uf' stays with lemmas on
+ * demand.
+ */
+static void
+dynamic_ackermannize(Bzla *bzla, BzlaNode *uf)
+{
+  assert(bzla);
+  assert(bzla->slv);
+  assert(bzla->slv->kind == BZLA_FUN_SOLVER_KIND);
+  assert(uf);
+  assert(bzla_node_is_regular(uf));
+  assert(bzla_node_is_uf(uf));
+
+  uint32_t i, threshold, num_lemmas = 0;
+  uint64_t limit;
+  BzlaFunSolver *slv;
+  BzlaHashTableData *d;
+  BzlaNode *app, *con;
+  BzlaNodeIterator it;
+  BzlaNodePtrStack applies, constraints;
+
+  slv       = BZLA_FUN_SOLVER(bzla);
+  threshold = bzla_opt_get(bzla, BZLA_OPT_FUN_DYNAMIC_ACK);
+  assert(threshold);
+
+  d = bzla_hashint_map_get(slv->ack_lemmas, uf->id);
+  if (!d)
+  {
+    d         = bzla_hashint_map_add(slv->ack_lemmas, uf->id);
+    d->as_int = 0;
+  }
+  /* already Ackermannized (or too expensive) */
+  if (d->as_int < 0) return;
+  d->as_int += 1;
+  if ((uint32_t) d->as_int < threshold) return;
+  d->as_int = -1;
+
+  BZLA_INIT_STACK(bzla->mm, applies);
+  bzla_iter_apply_parent_init(&it, uf);
+  while (bzla_iter_apply_parent_has_next(&it))
+  {
+    app = bzla_iter_apply_parent_next(&it);
+    if (app->parameterized || bzla_node_is_simplified(app)) continue;
+    BZLA_PUSH_STACK(applies, app);
+  }
+
+  limit = bzla_opt_get(bzla, BZLA_OPT_PP_ACKERMANN_LIMIT);
+  if (limit && bzla_ackermann_cost(BZLA_COUNT_STACK(applies)) > limit)
+  {
+    BZLA_RELEASE_STACK(applies);
+    return;
+  }
+
+  BZLA_INIT_STACK(bzla->mm, constraints);
+  bzla_ackermann_constraints(bzla, &applies, &constraints);
+  for (i = 0; i < BZLA_COUNT_STACK(constraints); i++)
+  {
+    con = BZLA_PEEK_STACK(constraints, i);
+    if (!bzla_hashptr_table_get(slv->lemmas, con))
+    {
+      bzla_hashptr_table_add(slv->lemmas, bzla_node_copy(bzla, con));
+      BZLA_PUSH_STACK(slv->cur_lemmas, con);
+      slv->stats.dynamic_ack_lemmas++;
+      num_lemmas++;
+    }
+    bzla_node_release(bzla, con);
+  }
+  slv->stats.dynamic_ack_funs++;
+  BZLALOG(1,
+          "dynamic ackermannization of %s: %u lemma(s)",
+          bzla_util_node2string(uf),
+          num_lemmas);
+  BZLA_RELEASE_STACK(constraints);
+  BZLA_RELEASE_STACK(applies);
+}
+
 static void
 propagate(Bzla *bzla,
           BzlaNodePtrStack *prop_stack,
@@ -1680,7 +2255,7 @@ propagate(Bzla *bzla,
   assert(apply_search_cache);
 
   double start;
-  uint32_t opt_eager_lemmas;
+  uint32_t opt_eager_lemmas, opt_dynamic_ack;
   bool prop_down, conflict, restart;
   BzlaBitVector *bv;
   BzlaMemMgr *mm;
@@ -1691,12 +2266,15 @@ propagate(Bzla *bzla,
   BzlaPtrHashTableIterator it;
   BzlaPtrHashTable *conds;
   BzlaIntHashTable *conf_apps;
+  BzlaFunWEG *weg;
 
   start            = bzla_util_time_stamp();
   mm               = bzla->mm;
   slv              = BZLA_FUN_SOLVER(bzla);
   conf_apps        = bzla_hashint_table_new(mm);
   opt_eager_lemmas = bzla_opt_get(bzla, BZLA_OPT_FUN_EAGER_LEMMAS);
+  opt_dynamic_ack  = bzla_opt_get(bzla, BZLA_OPT_FUN_DYNAMIC_ACK);
+  weg              = bzla_opt_get(bzla, BZLA_OPT_FUN_WEG) ? weg_new(mm) : 0;
 
   BZLALOG(1, "");
   BZLALOG(1, "*** %s", __FUNCTION__);
@@ -1767,10 +2345,13 @@ propagate(Bzla *bzla,
             bzla_hashint_table_add(conf_apps, app->id);
             restart = find_conflict_app(bzla, app, conf_apps);
           }
-          else if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_ALL)
+          else if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_ALL
+                   || opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_BATCH)
             restart = false;
           slv->stats.function_congruence_conflicts++;
           add_lemma(bzla, fun, hashed_app, app);
+          if (opt_dynamic_ack && bzla_node_is_uf(fun))
+            dynamic_ackermannize(bzla, fun);
           // conflict = true;
           /* stop at first conflict */
           if (restart) break;
@@ -1828,6 +2409,8 @@ propagate(Bzla *bzla,
 		    restart = false;
 #endif
 
+          /* collect all conflicts of this round */
+          if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_BATCH) restart = false;
           slv->stats.beta_reduction_conflicts++;
           add_lemma(bzla, fun, app, 0);
           conflict = true;
@@ -1843,7 +2426,16 @@ propagate(Bzla *bzla,
       {
         app->propagated = 0;
         BZLA_PUSH_STACK(*prop_stack, app);
-        BZLA_PUSH_STACK(*prop_stack, fun->e[0]);
+        cur = bzla_node_get_simplified(bzla, fun->e[0]);
+        /* skip stores with different index value */
+        if (weg && bzla_node_is_update(cur))
+        {
+          weg_add(bzla, weg, cur, prop_stack, apply_search_cache);
+          cur = weg_find(weg, cur, args);
+          slv->stats.weg_lookups++;
+          BZLALOG(1, "  skip to: %s", bzla_util_node2string(cur));
+        }
+        BZLA_PUSH_STACK(*prop_stack, cur);
         slv->stats.propagations_down++;
       }
       push_applies_for_propagation(
@@ -1857,10 +2449,8 @@ propagate(Bzla *bzla,
     conds = bzla_hashptr_table_new(mm,
                                    (BzlaHashPtr) bzla_node_hash_by_id,
                                    (BzlaCmpPtr) bzla_node_compare_by_id);
-    bzla_beta_assign_args(bzla, fun, args);
-    fun_value = bzla_beta_reduce_partial(bzla, fun, conds);
+    fun_value = beta_reduce_partial(bzla, fun, args, conds);
     assert(!bzla_node_is_fun(fun_value));
-    bzla_beta_unassign_params(bzla, fun);
 
     prop_down = false;
     if (!bzla_node_is_inverted(fun_value) && bzla_node_is_apply(fun_value))
@@ -1888,7 +2478,8 @@ propagate(Bzla *bzla,
         bzla_hashint_table_add(conf_apps, app->id);
         restart = find_conflict_app(bzla, app, conf_apps);
       }
-      else if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_ALL)
+      else if (opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_ALL
+               || opt_eager_lemmas == BZLA_FUN_EAGER_LEMMAS_BATCH)
         restart = false;
       slv->stats.beta_reduction_conflicts++;
       add_lemma(bzla, fun, app, 0);
@@ -1930,6 +2521,7 @@ propagate(Bzla *bzla,
     /* stop at first conflict */
     if (restart && conflict) break;
   }
+  if (weg) weg_delete(weg);
   bzla_hashint_table_delete(conf_apps);
   slv->time.prop += bzla_util_time_stamp() - start;
 }
@@ -2037,6 +2629,103 @@ generate_table(Bzla *bzla, BzlaNode *fun, BzlaNode **base_array)
   return table;
 }
 
+/* Model table of one side of a function equality, see generate_table. */
+struct BzlaFunExtTable
+{
+  BzlaPtrHashTable *table;
+  BzlaNode *base;
+};
+
+typedef struct BzlaFunExtTable BzlaFunExtTable;
+
+/* Get the model table of function 'fun' from 'cache', the table is only
+ * generated once per function per call of add_extensionality_lemmas. */
+static BzlaFunExtTable *
+get_ext_table(Bzla *bzla, BzlaPtrHashTable *cache, BzlaNode *fun)
+{
+  assert(bzla);
+  assert(cache);
+  assert(fun);
+
+  BzlaPtrHashBucket *b;
+  BzlaFunExtTable *res;
+
+  if ((b = bzla_hashptr_table_get(cache, fun))) return b->data.as_ptr;
+
+  BZLA_NEW(bzla->mm, res);
+  res->base  = 0;
+  res->table = generate_table(bzla, fun, &res->base);
+  assert(res->base);
+  bzla_hashptr_table_add(cache, fun)->data.as_ptr = res;
+  return res;
+}
+
+static void
+delete_ext_tables(Bzla *bzla, BzlaPtrHashTable *cache)
+{
+  assert(bzla);
+  assert(cache);
+
+  BzlaFunExtTable *t;
+  BzlaPtrHashTableIterator it;
+
+  bzla_iter_hashptr_init(&it, cache);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    t = it.bucket->data.as_ptr;
+    (void) bzla_iter_hashptr_next(&it);
+    bzla_hashptr_table_delete(t->table);
+    BZLA_DELETE(bzla->mm, t);
+  }
+  bzla_hashptr_table_delete(cache);
+}
+
+/* Collect all arguments on which the model tables 'table0' and 'table1'
+ * differ (either the values differ or one of the tables has no value). */
+static void
+collect_ext_conflicts(BzlaPtrHashTable *table0,
+                      BzlaPtrHashTable *table1,
+                      BzlaPtrHashTable *conflicts)
+{
+  assert(table0);
+  assert(table1);
+  assert(conflicts);
+
+  BzlaNode *value, *args;
+  BzlaPtrHashBucket *b;
+  BzlaPtrHashTableIterator it;
+
+  bzla_iter_hashptr_init(&it, table0);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    value = it.bucket->data.as_ptr;
+    args  = bzla_iter_hashptr_next(&it);
+    b     = bzla_hashptr_table_get(table1, args);
+
+    if (bzla_hashptr_table_get(conflicts, args)) continue;
+
+    if (!b || !equal_bv_assignments(value, b->data.as_ptr))
+      bzla_hashptr_table_add(conflicts, args);
+  }
+
+  /* all entries of 'table0' match, if both tables have the same number of
+   * entries they are equal */
+  if (!conflicts->count && table0->count == table1->count) return;
+
+  bzla_iter_hashptr_init(&it, table1);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    value = it.bucket->data.as_ptr;
+    args  = bzla_iter_hashptr_next(&it);
+    b     = bzla_hashptr_table_get(table0, args);
+
+    if (bzla_hashptr_table_get(conflicts, args)) continue;
+
+    if (!b || !equal_bv_assignments(value, b->data.as_ptr))
+      bzla_hashptr_table_add(conflicts, args);
+  }
+}
+
 static void
 add_extensionality_lemmas(Bzla *bzla)
 {
@@ -2048,14 +2737,15 @@ add_extensionality_lemmas(Bzla *bzla)
   bool skip;
   BzlaBitVector *evalbv;
   uint32_t num_lemmas = 0;
-  BzlaNode *cur, *cur_args, *app0, *app1, *eq, *con, *value;
+  BzlaNode *cur, *cur_args, *app0, *app1, *eq, *con;
   BzlaNode *base0, *base1;
   BzlaPtrHashTableIterator it;
-  BzlaPtrHashTable *table0, *table1, *conflicts;
+  BzlaPtrHashTable *tables, *conflicts;
   BzlaPtrHashTableIterator hit;
   BzlaNodePtrStack feqs, const_arrays;
   BzlaMemMgr *mm;
-  BzlaPtrHashBucket *b;
+  BzlaFunExtTable *ext0, *ext1;
+  BzlaUnionFind *equal_models;
   BzlaFunSolver *slv;
 
   start = bzla_util_time_stamp();
@@ -2077,6 +2767,13 @@ add_extensionality_lemmas(Bzla *bzla)
 
   BzlaUnionFind *ufind = bzla_ufind_new(bzla->mm);
 
+  /* model tables are generated once per function, functions with equal
+   * models are merged in 'equal_models' */
+  equal_models = bzla_ufind_new(mm);
+  tables       = bzla_hashptr_table_new(mm,
+                                        (BzlaHashPtr) bzla_node_hash_by_id,
+                                        (BzlaCmpPtr) bzla_node_compare_by_id);
+
   while (!BZLA_EMPTY_STACK(feqs))
   {
     cur = bzla_node_get_simplified(bzla, BZLA_POP_STACK(feqs));
@@ -2089,46 +2786,25 @@ add_extensionality_lemmas(Bzla *bzla)
 
     if (skip) continue;
 
-    base0 = base1 = 0;
-    table0        = generate_table(bzla, cur->e[0], &base0);
-    table1        = generate_table(bzla, cur->e[1], &base1);
-
-    assert(base0);
-    assert(base1);
+    ext0  = get_ext_table(bzla, tables, cur->e[0]);
+    ext1  = get_ext_table(bzla, tables, cur->e[1]);
+    base0 = ext0->base;
+    base1 = ext1->base;
 
     bzla_ufind_merge(ufind, base0, base1);
     BZLA_PUSH_STACK_IF(bzla_node_is_const_array(base0), const_arrays, base0);
     BZLA_PUSH_STACK_IF(bzla_node_is_const_array(base1), const_arrays, base1);
 
+    /* models were already found to be equal (transitively) */
+    bzla_ufind_add(equal_models, cur->e[0]);
+    bzla_ufind_add(equal_models, cur->e[1]);
+    if (bzla_ufind_is_equal(equal_models, cur->e[0], cur->e[1])) continue;
+
     conflicts = bzla_hashptr_table_new(mm,
                                        (BzlaHashPtr) hash_args_assignment,
                                        (BzlaCmpPtr) compare_args_assignments);
-
-    bzla_iter_hashptr_init(&hit, table0);
-    while (bzla_iter_hashptr_has_next(&hit))
-    {
-      value    = hit.bucket->data.as_ptr;
-      cur_args = bzla_iter_hashptr_next(&hit);
-      b        = bzla_hashptr_table_get(table1, cur_args);
-
-      if (bzla_hashptr_table_get(conflicts, cur_args)) continue;
-
-      if (!b || !equal_bv_assignments(value, b->data.as_ptr))
-        bzla_hashptr_table_add(conflicts, cur_args);
-    }
-
-    bzla_iter_hashptr_init(&hit, table1);
-    while (bzla_iter_hashptr_has_next(&hit))
-    {
-      value    = hit.bucket->data.as_ptr;
-      cur_args = bzla_iter_hashptr_next(&hit);
-      b        = bzla_hashptr_table_get(table0, cur_args);
-
-      if (bzla_hashptr_table_get(conflicts, cur_args)) continue;
-
-      if (!b || !equal_bv_assignments(value, b->data.as_ptr))
-        bzla_hashptr_table_add(conflicts, cur_args);
-    }
+    collect_ext_conflicts(ext0->table, ext1->table, conflicts);
+    if (!conflicts->count) bzla_ufind_merge(equal_models, cur->e[0], cur->e[1]);
 
     BZLALOG(1, "  %s", bzla_util_node2string(cur));
     bzla_iter_hashptr_init(&hit, conflicts);
@@ -2159,14 +2835,14 @@ add_extensionality_lemmas(Bzla *bzla)
       bzla_node_release(bzla, con);
     }
     bzla_hashptr_table_delete(conflicts);
-    bzla_hashptr_table_delete(table0);
-    bzla_hashptr_table_delete(table1);
   }
   BZLA_RELEASE_STACK(feqs);
+  delete_ext_tables(bzla, tables);
+  bzla_ufind_delete(equal_models);
 
   /* No conflicts found. Check if we have positive (chains of) equalities over
    * constant arrays. */
-  if (num_lemmas == 0)
+  if (BZLA_EMPTY_STACK(slv->cur_lemmas))
   {
     int32_t id;
     BzlaIntHashTable *cache = bzla_hashint_map_new(bzla->mm);
@@ -2260,6 +2936,99 @@ push_unreachable_applies(Bzla *bzla, BzlaNodePtrStack *init_apps)
   bzla_hashint_table_delete(cache);
 }
 
+static void
+update_lemmas_per_round(BzlaFunSolver *slv, uint32_t num_lemmas)
+{
+  assert(slv);
+  assert(num_lemmas > 0);
+
+  uint32_t bucket;
+
+  bucket = 0;
+  while (num_lemmas >> (bucket + 1)) bucket++;
+  while (BZLA_COUNT_STACK(slv->stats.lemmas_per_round) <= bucket)
+    BZLA_PUSH_STACK(slv->stats.lemmas_per_round, 0);
+  slv->stats.lemmas_per_round.start[bucket] += 1;
+}
+
+/* Check the current model of all abstracted FP operators (see
+ * BZLA_OPT_FP_LAZY_WORD_BLAST) against their concrete semantics and refine
+ * inconsistent abstractions by asserting their word-blasted encoding.
+ * Returns the number of refined abstractions. */
+static uint32_t
+refine_fp_abstractions(BzlaFunSolver *slv)
+{
+  assert(slv);
+
+  uint32_t i, j, first, res = 0;
+  Bzla *bzla;
+  BzlaNode *cur;
+  BzlaNodePtrStack abstractions;
+  BzlaSortId sort;
+  BzlaBitVector *bv;
+  BzlaRoundingMode rm;
+  BzlaFloatingPoint *ops[3], *value, *expected;
+  BzlaMemMgr *mm;
+
+  bzla = slv->bzla;
+  mm   = bzla->mm;
+  BZLA_INIT_STACK(mm, abstractions);
+  bzla_fp_word_blaster_get_abstractions(bzla, &abstractions);
+
+  for (i = 0; i < BZLA_COUNT_STACK(abstractions); i++)
+  {
+    cur  = BZLA_PEEK_STACK(abstractions, i);
+    sort = bzla_node_get_sort_id(cur);
+    assert(bzla_node_is_regular(cur));
+    assert(cur->av);
+
+    rm    = BZLA_RM_RNE;
+    first = bzla_node_is_fp_rem(cur) ? 0 : 1;
+    if (first)
+    {
+      bv = bzla_model_get_bv_assignment(bzla, cur->e[0]);
+      rm = bzla_rm_from_bv(bv);
+      bzla_bv_free(mm, bv);
+    }
+    for (j = first; j < cur->arity; j++)
+    {
+      bv = bzla_model_get_bv_assignment(bzla, cur->e[j]);
+      ops[j - first] =
+          bzla_fp_from_bv(bzla, bzla_node_get_sort_id(cur->e[j]), bv);
+      bzla_bv_free(mm, bv);
+    }
+    bv    = bzla_model_get_bv_assignment(bzla, cur);
+    value = bzla_fp_from_bv(bzla, sort, bv);
+    bzla_bv_free(mm, bv);
+
+    if (bzla_node_is_fp_div(cur))
+      expected = bzla_fp_div(bzla, rm, ops[0], ops[1]);
+    else if (bzla_node_is_fp_sqrt(cur))
+      expected = bzla_fp_sqrt(bzla, rm, ops[0]);
+    else if (bzla_node_is_fp_rem(cur))
+      expected = bzla_fp_rem(bzla, ops[0], ops[1]);
+    else
+    {
+      assert(bzla_node_is_fp_fma(cur));
+      expected = bzla_fp_fma(bzla, rm, ops[0], ops[1], ops[2]);
+    }
+
+    if (bzla_fp_compare(value, expected))
+    {
+      BZLALOG(1, "refine FP abstraction: %s", bzla_util_node2string(cur));
+      bzla_fp_word_blaster_refine(bzla, cur);
+      slv->stats.fp_refinements++;
+      res++;
+    }
+
+    bzla_fp_free(bzla, expected);
+    bzla_fp_free(bzla, value);
+    for (j = first; j < cur->arity; j++) bzla_fp_free(bzla, ops[j - first]);
+  }
+  BZLA_RELEASE_STACK(abstractions);
+  return res;
+}
+
 static void
 check_and_resolve_conflicts(Bzla *bzla,
                             Bzla *clone,
@@ -2353,8 +3122,12 @@ check_and_resolve_conflicts(Bzla *bzla,
   propagate(bzla, &prop_stack, cleanup_table, apply_search_cache);
   found_conflicts = BZLA_COUNT_STACK(slv->cur_lemmas) > 0;
 
-  /* check consistency of array/uf equalities */
-  if (!found_conflicts && bzla->feqs->count > 0)
+  /* check consistency of array/uf equalities, in batch mode also check
+   * extensionality if propagation already produced lemmas */
+  if ((!found_conflicts
+       || bzla_opt_get(bzla, BZLA_OPT_FUN_EAGER_LEMMAS)
+              == BZLA_FUN_EAGER_LEMMAS_BATCH)
+      && bzla->feqs->count > 0)
   {
     assert(BZLA_EMPTY_STACK(prop_stack));
     add_extensionality_lemmas(bzla);
@@ -2639,6 +3412,190 @@ check_sat_prels(BzlaFunSolver *slv, BzlaSolver **ls_slv)
   return result;
 }
 
+/* Enforce input bits that are fixed on the top level of the SAT solver in the
+ * current (local search) assignment. The prop engine additionally treats these
+ * bits as constant bits (see bzla_prop_solver_init_domains). */
+static void
+fix_model_bits_from_sat(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i, bw;
+  int32_t id, lit, val;
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+  BzlaSATMgr *smgr;
+  BzlaIntHashTableIterator it;
+
+  smgr = bzla_get_sat_mgr(bzla);
+  if (!bzla->bv_model || !smgr->satcalls) return;
+
+  bzla_iter_hashint_init(&it, bzla->bv_model);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    id  = bzla_iter_hashint_next(&it);
+    cur = bzla_node_get_by_id(bzla, id);
+    if (!cur || !cur->av || !bzla_lsutils_is_leaf_node(cur)) continue;
+    bv = bzla_hashint_map_get(bzla->bv_model, id)->as_ptr;
+    bw = cur->av->width;
+    assert(bzla_bv_get_width(bv) == bw);
+    for (i = 0; i < bw; i++)
+    {
+      if (bzla_aig_is_const(cur->av->aigs[i])) continue;
+      if (!(lit = bzla_aig_get_cnf_id(cur->av->aigs[i]))) continue;
+      if (!(val = bzla_sat_fixed(smgr, lit))) continue;
+      bzla_bv_set_bit(bv, bw - 1 - i, val > 0);
+      BZLA_FUN_SOLVER(bzla)->stats.hybrid_fixed_bits++;
+    }
+  }
+}
+
+/* Use the current (local search) assignment of the inputs as phases for the
+ * next SAT call. */
+static void
+set_sat_phases_from_model(Bzla *bzla)
+{
+  assert(bzla);
+
+  uint32_t i, bw;
+  int32_t id, lit;
+  BzlaNode *cur;
+  BzlaBitVector *bv;
+  BzlaSATMgr *smgr;
+  BzlaIntHashTableIterator it;
+
+  smgr = bzla_get_sat_mgr(bzla);
+  if (!bzla->bv_model || !bzla_sat_mgr_has_phase_support(smgr)) return;
+
+  bzla_iter_hashint_init(&it, bzla->bv_model);
+  while (bzla_iter_hashint_has_next(&it))
+  {
+    id  = bzla_iter_hashint_next(&it);
+    cur = bzla_node_get_by_id(bzla, id);
+    if (!cur || !cur->av || !bzla_lsutils_is_leaf_node(cur)) continue;
+    bv = bzla_hashint_map_get(bzla->bv_model, id)->as_ptr;
+    bw = cur->av->width;
+    assert(bzla_bv_get_width(bv) == bw);
+    for (i = 0; i < bw; i++)
+    {
+      if (bzla_aig_is_const(cur->av->aigs[i])) continue;
+      if (!(lit = bzla_aig_get_cnf_id(cur->av->aigs[i]))) continue;
+      bzla_sat_phase(smgr, bzla_bv_get_bit(bv, bw - 1 - i) ? lit : -lit);
+      BZLA_FUN_SOLVER(bzla)->stats.hybrid_phases++;
+    }
+  }
+}
+
+/* Interleave bounded runs of the local search engine with bounded SAT calls
+ * (BZLA_OPT_FUN_HYBRID). Limits are doubled every round. Information is
+ * exchanged between both engines via phases (local search -> SAT) and top
+ * level fixed input bits (SAT -> local search). The overall SAT limit
+ * (slv->sat_limit, if any) bounds the sum of the limits of all SAT calls. */
+static BzlaSolverResult
+check_sat_hybrid(BzlaFunSolver *slv, BzlaSolver **ls_slv)
+{
+  assert(slv);
+
+  bool is_prop;
+  uint32_t opt_ls_limit, ls_limit, ls_limit_total;
+  int32_t sat_limit, sat_limit_left;
+  BzlaOption opt;
+  Bzla *bzla;
+  BzlaSolverResult result;
+
+  bzla    = slv->bzla;
+  is_prop = bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP) != 0;
+  /* Note: prop limit is relative to the current number of propagations,
+   *       sls limit is absolute. */
+  opt          = is_prop ? BZLA_OPT_PROP_NPROPS : BZLA_OPT_SLS_NFLIPS;
+  opt_ls_limit = bzla_opt_get(bzla, opt);
+  ls_limit     = opt_ls_limit ? opt_ls_limit : BZLA_FUN_HYBRID_LS_LIMIT_INIT;
+  ls_limit_total = 0;
+  sat_limit      = BZLA_FUN_HYBRID_SAT_LIMIT_INIT;
+  sat_limit_left = slv->sat_limit;
+
+  for (;;)
+  {
+    bzla_process_unsynthesized_constraints(bzla);
+    if (bzla->found_constraint_false)
+    {
+      result = BZLA_RESULT_UNSAT;
+      break;
+    }
+    assert(bzla->unsynthesized_constraints->count == 0);
+
+    /* bounded local search run */
+    fix_model_bits_from_sat(bzla);
+    ls_limit_total = ls_limit_total > UINT32_MAX - ls_limit
+                         ? UINT32_MAX
+                         : ls_limit_total + ls_limit;
+    bzla_opt_set(bzla, opt, is_prop ? ls_limit : ls_limit_total);
+    result = check_sat_prels(slv, ls_slv);
+    bzla_opt_set(bzla, opt, opt_ls_limit);
+    if (result != BZLA_RESULT_UNKNOWN || bzla_terminate(bzla)) break;
+
+    /* bounded SAT call */
+    if (sat_limit_left == 0) break;
+    if (sat_limit_left > -1 && sat_limit > sat_limit_left)
+      sat_limit = sat_limit_left;
+    set_sat_phases_from_model(bzla);
+    bzla_add_again_assumptions(bzla);
+    result = timed_sat_sat(bzla, sat_limit);
+    if (result != BZLA_RESULT_UNKNOWN || bzla_terminate(bzla))
+    {
+      bzla_model_init_bv(bzla, &bzla->bv_model);
+      break;
+    }
+    if (sat_limit_left > -1) sat_limit_left -= sat_limit;
+
+    slv->stats.hybrid_rounds++;
+    BZLA_MSG(bzla->msg,
+             1,
+             "hybrid round %u: no result with limits %u (local search), "
+             "%d (SAT)",
+             slv->stats.hybrid_rounds,
+             ls_limit,
+             sat_limit);
+    if (!opt_ls_limit && ls_limit <= UINT32_MAX / 2) ls_limit *= 2;
+    if (sat_limit <= INT32_MAX / 2) sat_limit *= 2;
+  }
+
+  return result;
+}
+
+/* Run floating-point level local search (BZLA_OPT_FUN_PREFPLS). A satisfying
+ * assignment is confirmed by concrete evaluation of all constraints and
+ * assumptions, and the model is built from the values computed by the local
+ * search, i.e., the formula is neither word-blasted nor bit-blasted.
+ * Returns BZLA_RESULT_UNKNOWN if local search fails. */
+static BzlaSolverResult
+check_sat_fpls(BzlaFunSolver *slv)
+{
+  assert(slv);
+
+  Bzla *bzla;
+  BzlaSolverResult result;
+  BzlaFPLSStats stats;
+
+  bzla = slv->bzla;
+
+  if (!bzla_fpls_is_supported(bzla)) return BZLA_RESULT_UNKNOWN;
+
+  memset(&stats, 0, sizeof(BzlaFPLSStats));
+  bzla_model_init_bv(bzla, &bzla->bv_model);
+
+  result = bzla_fpls_sat(bzla, BZLA_FUN_FPLS_MAX_MOVES, bzla->bv_model, &stats);
+
+  slv->stats.fpls_moves += stats.moves;
+  slv->stats.fpls_props += stats.props;
+  slv->stats.fpls_props_inv += stats.props_inv;
+  slv->stats.fpls_props_cons += stats.props_cons;
+  slv->stats.fpls_conflicts += stats.conflicts;
+  if (result == BZLA_RESULT_SAT) slv->stats.fpls_confirmed = true;
+
+  return result;
+}
+
 static BzlaSolverResult
 sat_fun_solver(BzlaFunSolver *slv)
 {
@@ -2648,7 +3605,7 @@ sat_fun_solver(BzlaFunSolver *slv)
   assert(slv->bzla->slv == (BzlaSolver *) slv);
 
   uint32_t i;
-  bool opt_prels, opt_prop_const_bits;
+  bool opt_prels, opt_prop_const_bits, opt_hybrid, opt_prefpls, sat_model;
   BzlaSolverResult result;
   Bzla *bzla, *clone;
   BzlaNode *clone_root, *lemma;
@@ -2663,6 +3620,9 @@ sat_fun_solver(BzlaFunSolver *slv)
   opt_prels = bzla_opt_get(bzla, BZLA_OPT_FUN_PREPROP)
               || bzla_opt_get(bzla, BZLA_OPT_FUN_PRESLS);
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS) != 0;
+  opt_hybrid = opt_prels && bzla_opt_get(bzla, BZLA_OPT_FUN_HYBRID);
+  /* only run floating-point local search in the first round */
+  opt_prefpls = !opt_prels && bzla_opt_get(bzla, BZLA_OPT_FUN_PREFPLS);
 
   assert(!bzla->inconsistent);
 
@@ -2687,10 +3647,10 @@ sat_fun_solver(BzlaFunSolver *slv)
 
   if (bzla->feqs->count > 0) add_function_inequality_constraints(bzla);
 
-  /* initialize dual prop clone */
+  /* initialize or update dual prop clone */
   if (bzla_opt_get(bzla, BZLA_OPT_FUN_DUAL_PROP))
   {
-    clone = new_exp_layer_clone_for_dual_prop(bzla, &exp_map, &clone_root);
+    clone = get_dual_prop_clone(bzla, &exp_map, &clone_root);
   }
 
   BzlaPtrHashTableIterator it;
@@ -2705,7 +3665,8 @@ sat_fun_solver(BzlaFunSolver *slv)
 
   while (true)
   {
-    result = BZLA_RESULT_UNKNOWN;
+    result    = BZLA_RESULT_UNKNOWN;
+    sat_model = false;
 
     if (bzla_terminate(bzla)
         || (slv->lod_limit > -1
@@ -2714,7 +3675,11 @@ sat_fun_solver(BzlaFunSolver *slv)
       break;
     }
 
-    if (opt_prels)
+    if (opt_hybrid)
+    {
+      result = check_sat_hybrid(slv, &ls_slv);
+    }
+    else if (opt_prels)
     {
       if (opt_prop_const_bits)
       {
@@ -2731,7 +3696,16 @@ sat_fun_solver(BzlaFunSolver *slv)
       result = check_sat_prels(slv, &ls_slv);
     }
 
-    if (result == BZLA_RESULT_UNKNOWN)
+    if (result == BZLA_RESULT_UNKNOWN && opt_prefpls)
+    {
+      opt_prefpls = false;
+      result      = check_sat_fpls(slv);
+      /* the model was built by the local search, and the formula contains
+       * neither functions nor lazily word-blasted operators */
+      if (result == BZLA_RESULT_SAT) break;
+    }
+
+    if (result == BZLA_RESULT_UNKNOWN && !opt_hybrid)
     {
       /* Word-blasting may add new constraints. Make sure that these also get
        * synthesized. */
@@ -2748,7 +3722,8 @@ sat_fun_solver(BzlaFunSolver *slv)
       assert(bzla_dbg_check_all_hash_tables_simp_free(bzla));
 
       /* make SAT call on bv skeleton */
-      result = timed_sat_sat(bzla, slv->sat_limit);
+      result    = timed_sat_sat(bzla, slv->sat_limit);
+      sat_model = true;
 
       /* Initialize new bit vector model, which will be constructed while
        * consistency checking. This also deletes the model from the previous
@@ -2770,12 +3745,22 @@ sat_fun_solver(BzlaFunSolver *slv)
 
     assert(result == BZLA_RESULT_SAT);
 
+    /* refinements are asserted permanently (not as lemmas, which are only
+     * assumed with assume_lemmas) and synthesized in the next round */
+    if (sat_model && bzla_opt_get(bzla, BZLA_OPT_FP_LAZY_WORD_BLAST)
+        && refine_fp_abstractions(slv) > 0)
+    {
+      slv->stats.refinement_iterations++;
+      continue;
+    }
+
     if (bzla->ufs->count == 0 && bzla->lambdas->count == 0) break;
 
     check_and_resolve_conflicts(
         bzla, clone, clone_root, exp_map, &init_apps, init_apps_cache);
     if (BZLA_EMPTY_STACK(slv->cur_lemmas)) break;
     slv->stats.refinement_iterations++;
+    update_lemmas_per_round(slv, BZLA_COUNT_STACK(slv->cur_lemmas));
 
     BZLALOG(1, "add %d lemma(s)", BZLA_COUNT_STACK(slv->cur_lemmas));
     /* add generated lemmas to formula */
@@ -2822,9 +3807,17 @@ DONE:
   if (clone)
   {
     assert(exp_map);
-    bzla_nodemap_delete(exp_map);
     bzla_node_release(clone, clone_root);
-    bzla_delete(clone);
+    /* lemmas that are only assumed are not valid in subsequent sat calls */
+    if (slv->assume_lemmas)
+    {
+      bzla_nodemap_delete(exp_map);
+      delete_dual_prop_clone(slv);
+    }
+    else
+    {
+      save_dual_prop_map(slv, exp_map);
+    }
   }
   if (ls_slv)
   {
@@ -2853,6 +3846,13 @@ generate_model_fun_solver(BzlaFunSolver *slv,
   if (!slv->bzla->bv_model) bzla_model_init_bv(slv->bzla, &slv->bzla->bv_model);
   bzla_model_init_fun(slv->bzla, &slv->bzla->fun_model);
 
+  /* model values are computed on demand when queried */
+  if (!model_for_all_nodes
+      && bzla_opt_get(slv->bzla, BZLA_OPT_FUN_LAZY_MODEL))
+  {
+    return;
+  }
+
   bzla_model_generate(slv->bzla,
                       slv->bzla->bv_model,
                       slv->bzla->fun_model,
@@ -2883,6 +3883,39 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              1,
              "%7d assignments shared with bit-blasting engine",
              slv->stats.prels_shared);
+    if (bzla_opt_get(bzla, BZLA_OPT_FUN_HYBRID))
+    {
+      BZLA_MSG(bzla->msg, 1, "%7d hybrid rounds", slv->stats.hybrid_rounds);
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld phases set from local search assignment",
+               slv->stats.hybrid_phases);
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld input bits fixed by SAT solver",
+               slv->stats.hybrid_fixed_bits);
+    }
+  }
+
+  if (bzla_opt_get(bzla, BZLA_OPT_FUN_PREFPLS))
+  {
+    BZLA_MSG(bzla->msg, 1, "");
+    BZLA_MSG(bzla->msg, 1, "prefpls statistics:");
+    BZLA_MSG(bzla->msg, 1, "%7lld moves", slv->stats.fpls_moves);
+    BZLA_MSG(bzla->msg, 1, "%7lld propagations", slv->stats.fpls_props);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld inverse value propagations",
+             slv->stats.fpls_props_inv);
+    BZLA_MSG(bzla->msg,
+             1,
+             "%7lld closest value propagations",
+             slv->stats.fpls_props_cons);
+    BZLA_MSG(bzla->msg, 1, "%7lld conflicts", slv->stats.fpls_conflicts);
+    BZLA_MSG(bzla->msg,
+             1,
+             "        assignment %s by evaluation",
+             slv->stats.fpls_confirmed ? "confirmed" : "not confirmed");
   }
 
   if (bzla->ufs->count || bzla->lambdas->count)
@@ -2908,6 +3941,24 @@ print_stats_fun_solver(BzlaFunSolver *slv)
                1,
                "  %4d extensionality lemmas",
                slv->stats.extensionality_lemmas);
+      if (bzla_opt_get(bzla, BZLA_OPT_FUN_DYNAMIC_ACK))
+      {
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "  %4d dynamically ackermannized functions",
+                 slv->stats.dynamic_ack_funs);
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "  %4d ackermann lemmas",
+                 slv->stats.dynamic_ack_lemmas);
+      }
+      if (bzla_opt_get(bzla, BZLA_OPT_FP_LAZY_WORD_BLAST))
+      {
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "  %4d fp abstraction refinements",
+                 slv->stats.fp_refinements);
+      }
       BZLA_MSG(bzla->msg,
                1,
                "  %.1f average lemma size",
@@ -2922,6 +3973,21 @@ print_stats_fun_solver(BzlaFunSolver *slv)
                  slv->stats.lemmas_size.start[i],
                  i);
       }
+      BZLA_MSG(bzla->msg,
+               1,
+               "  %.1f average lemmas per refinement iteration",
+               BZLA_AVERAGE_UTIL(slv->stats.lod_refinements,
+                                 slv->stats.refinement_iterations));
+      for (i = 0; i < BZLA_COUNT_STACK(slv->stats.lemmas_per_round); i++)
+      {
+        if (!BZLA_PEEK_STACK(slv->stats.lemmas_per_round, i)) continue;
+        BZLA_MSG(bzla->msg,
+                 1,
+                 "    %4d iterations with %u-%u lemmas",
+                 BZLA_PEEK_STACK(slv->stats.lemmas_per_round, i),
+                 1u << i,
+                 (1u << (i + 1)) - 1);
+      }
     }
     BZLA_MSG(bzla->msg, 1, "");
     BZLA_MSG(bzla->msg,
@@ -2932,9 +3998,21 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              1,
              "%7lld partial beta reductions",
              bzla->stats.betap_reduce_calls);
+    if (bzla_opt_get(bzla, BZLA_OPT_FUN_BETA_CACHE))
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7" PRIu64 " partial beta reduction cache hits (%" PRIu64
+               " invalidated)",
+               slv->beta_cache->stats.hits,
+               slv->beta_cache->stats.invalid);
     BZLA_MSG(bzla->msg, 1, "%7lld propagations", slv->stats.propagations);
     BZLA_MSG(
         bzla->msg, 1, "%7lld propagations down", slv->stats.propagations_down);
+    if (bzla_opt_get(bzla, BZLA_OPT_FUN_WEG))
+      BZLA_MSG(bzla->msg,
+               1,
+               "%7lld store chain index lookups",
+               slv->stats.weg_lookups);
   }
 
   if (bzla_opt_get(bzla, BZLA_OPT_FUN_DUAL_PROP))
@@ -2949,6 +4027,7 @@ print_stats_fun_solver(BzlaFunSolver *slv)
              "%d/%d dual prop. applies (failed/assumed)",
              slv->stats.dp_failed_applies,
              slv->stats.dp_assumed_applies);
+    BZLA_MSG(bzla->msg, 1, "%d dual prop. clones", slv->stats.dp_clones);
   }
 }
 
@@ -3088,8 +4167,12 @@ bzla_new_fun_solver(Bzla *bzla)
                                        (BzlaCmpPtr) bzla_node_compare_by_id);
   BZLA_INIT_STACK(bzla->mm, slv->cur_lemmas);
   BZLA_INIT_STACK(bzla->mm, slv->constraints);
+  slv->ack_lemmas = bzla_hashint_map_new(bzla->mm);
 
   BZLA_INIT_STACK(bzla->mm, slv->stats.lemmas_size);
+  BZLA_INIT_STACK(bzla->mm, slv->stats.lemmas_per_round);
+
+  slv->beta_cache = bzla_beta_cache_new(bzla);
 
   BZLA_MSG(bzla->msg, 1, "enabled core engine");
 
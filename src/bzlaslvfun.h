@@ -11,6 +11,7 @@
 #ifndef BZLASLVFUN_H_INCLUDED
 #define BZLASLVFUN_H_INCLUDED
 
+#include "bzlabeta.h"
 #include "bzlanode.h"
 #include "bzlaslv.h"
 #include "utils/bzlahashptr.h"
@@ -26,6 +27,28 @@ struct BzlaFunSolver
   BzlaNodePtrStack constraints;
 
   BzlaPtrHashTable *score; /* dcr score */
+  /* ids of nodes visited while collecting the nodes that require a dcr
+   * score, only the cones of new roots are traversed in later rounds */
+  BzlaIntHashTable *score_visited;
+
+  /* number of function congruence lemmas per uninterpreted function (id),
+   * -1 if Ackermann constraints were added for the function
+   * (BZLA_OPT_FUN_DYNAMIC_ACK) */
+  BzlaIntHashTable *ack_lemmas;
+
+  /* dual propagation clone (BZLA_OPT_FUN_DUAL_PROP), kept across sat calls
+   * and updated incrementally with new constraints and lemmas */
+  struct
+  {
+    Bzla *clone;
+    BzlaNode *root;             /* conjunction of constraints and lemmas */
+    BzlaIntHashTable *node_map; /* maps node ids to clone nodes */
+    BzlaIntHashTable *synced;   /* ids of constraints conjoined to root */
+  } dp;
+
+  /* partial beta reduction results (BZLA_OPT_FUN_BETA_CACHE), shared across
+   * refinement iterations and sat calls */
+  BzlaBetaCache *beta_cache;
 
   // TODO (ma): make options for these
   int32_t lod_limit;
@@ -40,9 +63,17 @@ struct BzlaFunSolver
     uint32_t function_congruence_conflicts;
     uint32_t beta_reduction_conflicts;
     uint32_t extensionality_lemmas;
+    uint32_t dynamic_ack_funs;   /* number of dynamically Ackermannized
+                                    functions */
+    uint32_t dynamic_ack_lemmas; /* number of Ackermann constraints added as
+                                    lemmas */
+    uint32_t fp_refinements;     /* number of refined FP abstractions */
 
     BzlaUIntStack lemmas_size;      /* distribution of n-size lemmas */
     uint_least64_t lemmas_size_sum; /* sum of the size of all added lemmas */
+    BzlaUIntStack lemmas_per_round; /* distribution of lemmas per refinement
+                                       round, bucket i counts rounds with
+                                       2^i to 2^(i+1)-1 lemmas */
 
     uint32_t dp_failed_vars; /* number of vars in FA (dual prop) of last
                                 sat call (final bv skeleton) */
@@ -52,13 +83,30 @@ struct BzlaFunSolver
     uint32_t dp_assumed_applies;
     uint32_t dp_failed_eqs;
     uint32_t dp_assumed_eqs;
+    uint32_t dp_clones; /* number of (re)created dual prop clones */
 
     /* number of assignments shared from local search engine */
     uint32_t prels_shared;
+    /* number of local search/SAT rounds in hybrid mode */
+    uint32_t hybrid_rounds;
+    /* number of phases set from local search assignment in hybrid mode */
+    uint_least64_t hybrid_phases;
+    /* number of input bits fixed by the SAT solver in hybrid mode */
+    uint_least64_t hybrid_fixed_bits;
+
+    /* floating-point local search pre-pass */
+    uint_least64_t fpls_moves;
+    uint_least64_t fpls_props;
+    uint_least64_t fpls_props_inv;
+    uint_least64_t fpls_props_cons;
+    uint_least64_t fpls_conflicts;
+    /* true if a local search assignment was confirmed by evaluation */
+    bool fpls_confirmed;
 
     uint_least64_t eval_exp_calls;
     uint_least64_t propagations;
     uint_least64_t propagations_down;
+    uint_least64_t weg_lookups; /* number of store chain index lookups */
   } stats;
 
   struct
@@ -25,12 +25,14 @@
 #include "bzlaopt.h"
 #include "bzlaprintmodel.h"
 #include "bzlaproputils.h"
+#include "bzlasat.h"
 #include "bzlaslsutils.h"
 #include "dumper/bzladumpsmt.h"
 #include "utils/bzlaabort.h"
 #include "utils/bzlahash.h"
 #include "utils/bzlahashint.h"
 #include "utils/bzlahashptr.h"
+#include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
 /*------------------------------------------------------------------------*/
@@ -50,7 +52,6 @@ select_constraint(Bzla *bzla, uint32_t nmoves)
 
   BzlaNode *res, *cur;
   BzlaPropSolver *slv;
-  BzlaIntHashTableIterator it;
 
   slv = BZLA_PROP_SOLVER(bzla);
   assert(slv);
@@ -78,15 +79,21 @@ select_constraint(Bzla *bzla, uint32_t nmoves)
   if (bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
   {
     assert(slv->score);
+    assert(slv->selected);
 
-    int32_t *selected;
+    size_t i;
+    int32_t id, *selected;
     double value, max_value, score;
+    BzlaHashTableData *d;
+
     max_value = 0.0;
-    bzla_iter_hashint_init(&it, slv->roots);
-    while (bzla_iter_hashint_has_next(&it))
+    for (i = 0; i < BZLA_COUNT_STACK(slv->roots_stack); i++)
     {
-      selected = &slv->roots->data[it.cur_pos].as_int;
-      cur      = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&it));
+      id  = BZLA_PEEK_STACK(slv->roots_stack, i);
+      cur = bzla_node_get_by_id(bzla, id);
+      d   = bzla_hashint_map_get(slv->selected, id);
+      if (!d) d = bzla_hashint_map_add(slv->selected, id);
+      selected = &d->as_int;
 
       assert(bzla_hashint_map_contains(slv->score, bzla_node_get_id(cur)));
       score = bzla_hashint_map_get(slv->score, bzla_node_get_id(cur))->as_dbl;
@@ -103,16 +110,13 @@ select_constraint(Bzla *bzla, uint32_t nmoves)
   }
   else
   {
-    size_t j, r;
+    uint32_t r;
 
-    j = 0;
-    r = bzla_rng_pick_rand(bzla->rng, 0, slv->roots->count - 1);
-    bzla_iter_hashint_init(&it, slv->roots);
-    while (bzla_iter_hashint_has_next(&it) && j <= r)
-    {
-      res = bzla_node_get_by_id(bzla, bzla_iter_hashint_next(&it));
-      j += 1;
-    }
+    /* uniform selection in constant time */
+    assert(BZLA_COUNT_STACK(slv->roots_stack) == slv->roots->count);
+    r   = bzla_rng_pick_rand(
+        bzla->rng, 0, BZLA_COUNT_STACK(slv->roots_stack) - 1);
+    res = bzla_node_get_by_id(bzla, BZLA_PEEK_STACK(slv->roots_stack, r));
     assert(res);
     assert(!bzla_node_is_bv_const(res));
   }
@@ -253,6 +257,7 @@ move(Bzla *bzla, uint64_t nprops)
       bzla,
       bzla->bv_model,
       slv->roots,
+      &slv->roots_stack,
       bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT) ? slv->score : 0,
       exps,
       true,
@@ -304,6 +309,7 @@ clone_prop_solver(Bzla *clone, BzlaPropSolver *slv, BzlaNodeMap *exp_map)
   assert(slv);
   assert(slv->kind == BZLA_PROP_SOLVER_KIND);
 
+  size_t i;
   BzlaPropSolver *res;
 
   (void) exp_map;
@@ -313,6 +319,12 @@ clone_prop_solver(Bzla *clone, BzlaPropSolver *slv, BzlaNodeMap *exp_map)
 
   res->bzla  = clone;
   res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
+  BZLA_INIT_STACK(clone->mm, res->roots_stack);
+  for (i = 0; i < BZLA_COUNT_STACK(slv->roots_stack); i++)
+  {
+    BZLA_PUSH_STACK(res->roots_stack, BZLA_PEEK_STACK(slv->roots_stack, i));
+  }
+  res->selected = bzla_hashint_map_clone(clone->mm, slv->selected, 0, 0);
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
   // TODO clone const_bits
@@ -338,7 +350,9 @@ delete_prop_solver(BzlaPropSolver *slv)
   BzlaIntHashTableIterator it;
 
   if (slv->score) bzla_hashint_map_delete(slv->score);
+  if (slv->selected) bzla_hashint_map_delete(slv->selected);
   if (slv->roots) bzla_hashint_map_delete(slv->roots);
+  BZLA_RELEASE_STACK(slv->roots_stack);
 
   bzla_iter_hashint_init(&it, slv->domains);
   while (bzla_iter_hashint_has_next(&it))
@@ -366,6 +380,7 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   assert(root);
 
   uint32_t i, bw, idx;
+  int32_t lit, val;
   BzlaNode *cur, *real_cur;
   BzlaNodePtrStack visit;
   BzlaIntHashTable *cache;
@@ -373,11 +388,20 @@ bzla_prop_solver_init_domains(Bzla *bzla,
   BzlaMemMgr *mm;
   BzlaAIGVec *av;
   BzlaBvDomain *domain, *invdomain;
-  bool opt_prop_const_bits;
+  BzlaSATMgr *smgr;
+  bool opt_prop_const_bits, use_sat_fixed;
 
   mm                  = bzla->mm;
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS) != 0;
 
+  /* In hybrid mode (--fun-hybrid), additionally fix the bits of inputs that
+   * are fixed on the top level of the SAT solver. We only consider inputs
+   * since their current assignment is guaranteed to respect these bits (see
+   * sat_fun_solver). */
+  smgr          = bzla_get_sat_mgr(bzla);
+  use_sat_fixed = bzla_opt_get(bzla, BZLA_OPT_FUN_HYBRID) && smgr
+                  && bzla_sat_is_initialized(smgr) && smgr->satcalls > 0;
+
   cache = bzla_hashint_map_new(mm);
   BZLA_INIT_STACK(mm, visit);
 
@@ -434,6 +458,15 @@ bzla_prop_solver_init_domains(Bzla *bzla,
                 invdomain, idx, bzla_aig_is_false(av->aigs[i]));
             BZLA_PROP_SOLVER(bzla)->stats.fixed_bits++;
           }
+          else if (use_sat_fixed && bzla_lsutils_is_leaf_node(real_cur)
+                   && (lit = bzla_aig_get_cnf_id(av->aigs[i]))
+                   && (val = bzla_sat_fixed(smgr, lit)))
+          {
+            bzla_bvdomain_fix_bit(domain, idx, val > 0);
+            bzla_bvdomain_fix_bit(invdomain, idx, val < 0);
+            BZLA_PROP_SOLVER(bzla)->stats.fixed_bits++;
+            BZLA_PROP_SOLVER(bzla)->stats.fixed_bits_sat++;
+          }
         }
         BZLA_PROP_SOLVER(bzla)->stats.total_bits += bw;
       }
@@ -671,6 +704,200 @@ synthesize_constraints(Bzla *bzla)
   }
 }
 
+/*------------------------------------------------------------------------*/
+
+bool
+bzla_prop_solver_supports_funs(Bzla *bzla)
+{
+  assert(bzla);
+
+  BzlaPtrHashTableIterator it;
+
+  if (bzla->feqs->count > 0 || bzla->quantifiers->count > 0) return false;
+
+  bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
+  bzla_iter_hashptr_queue(&it, bzla->assumptions);
+  while (bzla_iter_hashptr_has_next(&it))
+  {
+    if (bzla_node_real_addr(bzla_iter_hashptr_next(&it))->lambda_below)
+      return false;
+  }
+  return true;
+}
+
+static BzlaBitVectorTuple *
+mk_args_tuple(Bzla *bzla, BzlaNode *args)
+{
+  assert(bzla_node_is_args(args));
+
+  uint32_t pos = 0;
+  BzlaArgsIterator it;
+  BzlaBitVectorTuple *res;
+
+  res = bzla_bv_new_tuple(bzla->mm, bzla_node_args_get_arity(bzla, args));
+  bzla_iter_args_init(&it, args);
+  while (bzla_iter_args_has_next(&it))
+  {
+    bzla_bv_add_to_tuple(bzla->mm,
+                         res,
+                         bzla_model_get_bv(bzla, bzla_iter_args_next(&it)),
+                         pos++);
+  }
+  return res;
+}
+
+/**
+ * Repair the current assignment of function applications (which are treated
+ * as inputs during local search) to be consistent w.r.t. function congruence
+ * and the read-over-write semantics of updates (array stores).
+ *
+ * The value of an application is determined by resolving its function through
+ * updates and function conditionals down to the base UF, where the first
+ * application (in ascending id order) with a given argument assignment
+ * defines the value. Applications are processed in ascending id order, thus
+ * the arguments of an application are always fixed before the application
+ * itself is checked and a single pass is sufficient. Repairing an application
+ * may falsify roots, which are then again subject to local search moves.
+ *
+ * If 'set_rho' is true, the defining applications of base UFs are recorded
+ * in 'rho' for model generation.
+ *
+ * Returns the number of repaired applications.
+ */
+static uint32_t
+repair_fun_consistency(BzlaPropSolver *slv, bool set_rho)
+{
+  assert(slv);
+
+  uint32_t i, res = 0;
+  Bzla *bzla;
+  BzlaMemMgr *mm;
+  BzlaNode *cur, *fun;
+  BzlaBitVectorTuple *t, *tu;
+  const BzlaBitVector *expected;
+  BzlaIntHashTable *models, *exps;
+  BzlaIntHashTableIterator iit;
+  BzlaPtrHashTableIterator it;
+  BzlaPtrHashTable *table;
+  BzlaPtrHashBucket *b;
+  BzlaHashTableData *d;
+
+  bzla   = slv->bzla;
+  mm     = bzla->mm;
+  models = bzla_hashint_map_new(mm);
+
+  for (i = 1; i < BZLA_COUNT_STACK(bzla->nodes_id_table); i++)
+  {
+    cur = BZLA_PEEK_STACK(bzla->nodes_id_table, i);
+    if (!cur || !bzla_node_is_apply(cur) || cur->parameterized) continue;
+    if (!bzla_hashint_map_contains(bzla->bv_model, cur->id)) continue;
+
+    t        = mk_args_tuple(bzla, cur->e[1]);
+    expected = 0;
+    fun      = cur->e[0];
+    for (;;)
+    {
+      assert(bzla_node_is_regular(fun));
+      if (bzla_node_is_update(fun))
+      {
+        tu = mk_args_tuple(bzla, fun->e[1]);
+        if (!bzla_bv_compare_tuple(t, tu))
+        {
+          expected = bzla_model_get_bv(bzla, fun->e[2]);
+        }
+        bzla_bv_free_tuple(mm, tu);
+        if (expected) break;
+        fun = fun->e[0];
+      }
+      else if (bzla_node_is_fun_cond(fun))
+      {
+        fun = bzla_bv_is_true(bzla_model_get_bv(bzla, fun->e[0])) ? fun->e[1]
+                                                                 : fun->e[2];
+      }
+      else
+      {
+        assert(bzla_node_is_uf(fun));
+        if (!(d = bzla_hashint_map_get(models, fun->id)))
+        {
+          d = bzla_hashint_map_add(models, fun->id);
+          d->as_ptr =
+              bzla_hashptr_table_new(mm,
+                                     (BzlaHashPtr) bzla_bv_hash_tuple,
+                                     (BzlaCmpPtr) bzla_bv_compare_tuple);
+        }
+        table = d->as_ptr;
+        if ((b = bzla_hashptr_table_get(table, t)))
+        {
+          expected = bzla_model_get_bv(bzla, b->data.as_ptr);
+        }
+        else
+        {
+          b = bzla_hashptr_table_add(table, bzla_bv_copy_tuple(mm, t));
+          b->data.as_ptr = cur;
+          if (set_rho)
+          {
+            if (!fun->rho)
+            {
+              fun->rho =
+                  bzla_hashptr_table_new(mm,
+                                         (BzlaHashPtr) bzla_node_hash_by_id,
+                                         (BzlaCmpPtr) bzla_node_compare_by_id);
+              BZLA_PUSH_STACK(bzla->functions_with_model,
+                              bzla_node_copy(bzla, fun));
+            }
+            if (!bzla_hashptr_table_get(fun->rho, cur->e[1]))
+            {
+              bzla_hashptr_table_add(fun->rho, cur->e[1])->data.as_ptr = cur;
+            }
+          }
+        }
+        break;
+      }
+    }
+    bzla_bv_free_tuple(mm, t);
+
+    if (expected && bzla_bv_compare(expected, bzla_model_get_bv(bzla, cur)))
+    {
+      BZLALOG(1, "repair inconsistent apply %s", bzla_util_node2string(cur));
+      exps = bzla_hashint_map_new(mm);
+      bzla_hashint_map_add(exps, cur->id)->as_ptr = bzla_bv_copy(mm, expected);
+      bzla_lsutils_update_cone(
+          bzla,
+          bzla->bv_model,
+          slv->roots,
+          &slv->roots_stack,
+          bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT) ? slv->score : 0,
+          exps,
+          true,
+          &slv->stats.updates,
+          &slv->time.update_cone,
+          &slv->time.update_cone_reset,
+          &slv->time.update_cone_model_gen,
+          &slv->time.update_cone_compute_score);
+      bzla_bv_free(mm, bzla_hashint_map_get(exps, cur->id)->as_ptr);
+      bzla_hashint_map_delete(exps);
+      res += 1;
+    }
+  }
+
+  bzla_iter_hashint_init(&iit, models);
+  while (bzla_iter_hashint_has_next(&iit))
+  {
+    table = bzla_iter_hashint_next_data(&iit)->as_ptr;
+    bzla_iter_hashptr_init(&it, table);
+    while (bzla_iter_hashptr_has_next(&it))
+    {
+      bzla_bv_free_tuple(mm, bzla_iter_hashptr_next(&it));
+    }
+    bzla_hashptr_table_delete(table);
+  }
+  bzla_hashint_map_delete(models);
+
+  slv->stats.fun_repairs += res;
+  return res;
+}
+
 /* This is an extra function in order to be able to test completeness
  * via test suite. */
 int32_t
@@ -682,6 +909,7 @@ bzla_prop_solver_sat(Bzla *bzla)
   uint32_t j, max_steps;
   int32_t sat_result;
   uint32_t nprops, opt_prop_const_bits, opt_verbosity = 0;
+  bool opt_prop_fun;
   uint64_t progress_steps, progress_steps_inc, nupdates;
   BzlaNode *root, *not_root;
   BzlaPtrHashTableIterator it;
@@ -703,6 +931,9 @@ bzla_prop_solver_sat(Bzla *bzla)
   opt_prop_const_bits = bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_BITS);
   opt_verbosity       = bzla_opt_get(bzla, BZLA_OPT_VERBOSITY);
 
+  opt_prop_fun =
+      bzla->ufs->count > 0 && bzla_opt_get(bzla, BZLA_OPT_PROP_FUN);
+
   if (nprops)
   {
     nprops += slv->stats.props;
@@ -771,6 +1002,7 @@ bzla_prop_solver_sat(Bzla *bzla)
 
     /* collect unsatisfied roots (kept up-to-date in update_cone) */
     assert(!slv->roots);
+    assert(BZLA_EMPTY_STACK(slv->roots_stack));
     slv->roots = bzla_hashint_map_new(bzla->mm);
     bzla_iter_hashptr_init(&it, bzla->unsynthesized_constraints);
     bzla_iter_hashptr_queue(&it, bzla->synthesized_constraints);
@@ -784,12 +1016,16 @@ bzla_prop_solver_sat(Bzla *bzla)
       {
         if (bzla_node_is_bv_const(root))
           goto UNSAT; /* contains false constraint -> unsat */
-        bzla_hashint_map_add(slv->roots, bzla_node_get_id(root));
+        bzla_lsutils_roots_add(
+            slv->roots, &slv->roots_stack, bzla_node_get_id(root));
       }
     }
 
     if (!slv->score && bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
-      slv->score = bzla_hashint_map_new(bzla->mm);
+    {
+      slv->score    = bzla_hashint_map_new(bzla->mm);
+      slv->selected = bzla_hashint_map_new(bzla->mm);
+    }
 
     if (bzla_terminate(bzla))
     {
@@ -798,7 +1034,11 @@ bzla_prop_solver_sat(Bzla *bzla)
     }
 
     /* all constraints sat? */
-    if (!slv->roots->count) goto SAT;
+    if (!slv->roots->count)
+    {
+      if (opt_prop_fun) repair_fun_consistency(slv, false);
+      if (!slv->roots->count) goto SAT;
+    }
 
     /* compute initial sls score */
     if (bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
@@ -838,17 +1078,24 @@ bzla_prop_solver_sat(Bzla *bzla)
       if (!(move(bzla, nprops))) goto UNSAT;
 
       /* all constraints sat? */
-      if (!slv->roots->count) goto SAT;
+      if (!slv->roots->count)
+      {
+        if (opt_prop_fun) repair_fun_consistency(slv, false);
+        if (!slv->roots->count) goto SAT;
+      }
     }
 
     /* restart */
     slv->api.generate_model((BzlaSolver *) slv, false, true);
     bzla_hashint_map_delete(slv->roots);
     slv->roots = 0;
+    BZLA_RESET_STACK(slv->roots_stack);
     if (bzla_opt_get(bzla, BZLA_OPT_PROP_USE_BANDIT))
     {
       bzla_hashint_map_delete(slv->score);
-      slv->score = bzla_hashint_map_new(bzla->mm);
+      bzla_hashint_map_delete(slv->selected);
+      slv->score    = bzla_hashint_map_new(bzla->mm);
+      slv->selected = bzla_hashint_map_new(bzla->mm);
     }
     slv->stats.restarts += 1;
     bzla_proputils_reset_prop_info_stack(slv->bzla->mm, &slv->toprop);
@@ -856,6 +1103,15 @@ bzla_prop_solver_sat(Bzla *bzla)
 
 SAT:
   sat_result = BZLA_RESULT_SAT;
+  /* All applications are consistent at this point, we only record the
+   * applications that define the UF models in 'rho' and regenerate the model
+   * accordingly. If prop is used as preprocessing engine (fun engine), 'rho'
+   * is maintained by the fun engine. */
+  if (opt_prop_fun && bzla_opt_get(bzla, BZLA_OPT_ENGINE) == BZLA_ENGINE_PROP)
+  {
+    repair_fun_consistency(slv, true);
+    slv->api.generate_model((BzlaSolver *) slv, false, true);
+  }
   goto DONE;
 
 UNSAT:
@@ -869,11 +1125,17 @@ DONE:
     bzla_hashint_map_delete(slv->roots);
     slv->roots = 0;
   }
+  BZLA_RESET_STACK(slv->roots_stack);
   if (slv->score)
   {
     bzla_hashint_map_delete(slv->score);
     slv->score = 0;
   }
+  if (slv->selected)
+  {
+    bzla_hashint_map_delete(slv->selected);
+    slv->selected = 0;
+  }
   // TODO: domains shouldn't be deleted after every sat call
   if (slv->domains)
   {
@@ -1005,6 +1267,11 @@ print_stats_prop_solver(BzlaPropSolver *slv)
            1,
            "updates per second: %u",
            slv->stats.updates / slv->time.check_sat);
+  if (bzla_opt_get(bzla, BZLA_OPT_PROP_FUN))
+    BZLA_MSG(bzla->msg,
+             1,
+             "repaired function applications: %zu",
+             slv->stats.fun_repairs);
 #ifndef NDEBUG
   char *s_cons = "    consistent fun calls";
   char *s_inv  = "    inverse fun calls";
@@ -1057,6 +1324,13 @@ print_stats_prop_solver(BzlaPropSolver *slv)
              slv->stats.fixed_bits,
              slv->stats.total_bits,
              (double) slv->stats.fixed_bits / slv->stats.total_bits * 100);
+    if (bzla_opt_get(bzla, BZLA_OPT_FUN_HYBRID))
+    {
+      BZLA_MSG(bzla->msg,
+               1,
+               "    fixed by SAT solver: %zu",
+               slv->stats.fixed_bits_sat);
+    }
   }
 
   if (bzla_opt_get(bzla, BZLA_OPT_PROP_CONST_DOMAINS))
@@ -1130,6 +1404,7 @@ bzla_new_prop_solver(Bzla *bzla)
       (BzlaSolverPrintTimeStats) print_time_stats_prop_solver;
   slv->api.print_model = (BzlaSolverPrintModel) print_model_prop_solver;
 
+  BZLA_INIT_STACK(bzla->mm, slv->roots_stack);
   BZLA_INIT_STACK(bzla->mm, slv->toprop);
 #ifndef NDEBUG
   BZLA_INIT_STACK(bzla->mm, slv->prop_path);
@@ -21,9 +21,16 @@ struct BzlaPropSolver
 {
   BZLA_SOLVER_STRUCT;
 
-  /* Map, maintains the roots.
-   * Maps root to 'selected' (= how often it got selected) */
+  /* Map, maintains the unsatisfied roots.
+   * Maps root to its position in 'roots_stack'. */
   BzlaIntHashTable *roots;
+  /* Stack, maintains the ids of all unsatisfied roots, allows to select
+   * a root uniformly at random in constant time. */
+  BzlaIntStack roots_stack;
+
+  /* Map, maps root to 'selected' (= how often it got selected), only used
+   * if BZLA_OPT_PROP_USE_BANDIT is enabled. */
+  BzlaIntHashTable *selected;
 
   /* Map, maintains SLS score.
    * Maps node to its SLS score, only used for heuristically selecting
@@ -90,6 +97,9 @@ struct BzlaPropSolver
     /* Number of updates performed when updating the cone of influence in the
      * current assignment as a consequence of a move. */
     uint64_t updates;
+    /* Number of function applications repaired to be consistent w.r.t.
+     * function congruence and updates (if BZLA_OPT_PROP_FUN). */
+    uint64_t fun_repairs;
 
     /* Number of calls to inverse value computation functions. */
     uint32_t inv_add;
@@ -127,6 +137,8 @@ struct BzlaPropSolver
 
     /* constant bit information */
     uint64_t fixed_bits;
+    /* Number of bits fixed by the SAT solver (if BZLA_OPT_FUN_HYBRID). */
+    uint64_t fixed_bits_sat;
     uint64_t total_bits;
     uint64_t updated_domains;
     uint64_t updated_domains_children;
@@ -153,6 +165,13 @@ void bzla_prop_solver_init_domains(Bzla *bzla,
                                    BzlaNode *root);
 
 int32_t bzla_prop_solver_sat(Bzla *bzla);
+
+/**
+ * Return true if the prop engine supports the current input formula with
+ * UFs and arrays (BZLA_OPT_PROP_FUN), i.e., it does not contain lambdas,
+ * function equalities or quantifiers.
+ */
+bool bzla_prop_solver_supports_funs(Bzla *bzla);
 /*------------------------------------------------------------------------*/
 
 #endif
@@ -93,25 +93,25 @@ select_candidate_constraint(Bzla *bzla, uint32_t nmoves)
   int32_t id;
   BzlaNode *res;
   BzlaSLSSolver *slv;
-  BzlaIntHashTableIterator it;
 
   slv = BZLA_SLS_SOLVER(bzla);
   assert(slv);
   assert(slv->roots);
   assert(slv->score);
+  assert(BZLA_COUNT_STACK(slv->roots_stack) == slv->roots->count);
 
   res = 0;
 
   if (bzla_opt_get(bzla, BZLA_OPT_SLS_USE_BANDIT))
   {
+    size_t i;
     double value, max_value;
     BzlaSLSConstrData *d;
 
     max_value = 0.0;
-    bzla_iter_hashint_init(&it, slv->roots);
-    while (bzla_iter_hashint_has_next(&it))
+    for (i = 0; i < BZLA_COUNT_STACK(slv->roots_stack); i++)
     {
-      id = bzla_iter_hashint_next(&it);
+      id = BZLA_PEEK_STACK(slv->roots_stack, i);
       assert(!bzla_node_is_bv_const(bzla_node_get_by_id(bzla, id))
              || !bzla_bv_is_zero(
                  bzla_model_get_bv(bzla, bzla_node_get_by_id(bzla, id))));
@@ -133,26 +133,19 @@ select_candidate_constraint(Bzla *bzla, uint32_t nmoves)
   else
   {
     uint32_t r;
-    BzlaNode *cur;
-    BzlaNodePtrStack stack;
 
-    BZLA_INIT_STACK(bzla->mm, stack);
-    bzla_iter_hashint_init(&it, slv->roots);
-    while (bzla_iter_hashint_has_next(&it))
-    {
-      id  = bzla_iter_hashint_next(&it);
-      cur = bzla_node_get_by_id(bzla, id);
-      assert(!bzla_node_is_bv_const(cur)
-             || !bzla_bv_is_zero(bzla_model_get_bv(bzla, cur)));
-      assert(bzla_hashint_map_contains(slv->score, id));
-      score = bzla_hashint_map_get(slv->score, id)->as_dbl;
-      assert(score < 1.0);
-      BZLA_PUSH_STACK(stack, cur);
-    }
-    assert(BZLA_COUNT_STACK(stack));
-    r   = bzla_rng_pick_rand(bzla->rng, 0, BZLA_COUNT_STACK(stack) - 1);
-    res = stack.start[r];
-    BZLA_RELEASE_STACK(stack);
+    /* uniform selection in constant time */
+    assert(BZLA_COUNT_STACK(slv->roots_stack));
+    r   = bzla_rng_pick_rand(
+        bzla->rng, 0, BZLA_COUNT_STACK(slv->roots_stack) - 1);
+    id  = BZLA_PEEK_STACK(slv->roots_stack, r);
+    res = bzla_node_get_by_id(bzla, id);
+    assert(!bzla_node_is_bv_const(res)
+           || !bzla_bv_is_zero(bzla_model_get_bv(bzla, res)));
+    assert(bzla_hashint_map_contains(slv->score, id));
+    score = bzla_hashint_map_get(slv->score, id)->as_dbl;
+    assert(score < 1.0);
+    (void) score;
   }
 
   assert(res);
@@ -280,14 +273,16 @@ update_assertion_weights(Bzla *bzla)
   }
   else
   {
-    /* increase the weight of all unsatisfied assertions */
-    bzla_iter_hashint_init(&it, slv->weights);
-    while (bzla_iter_hashint_has_next(&it))
+    size_t i;
+
+    /* increase the weight of all unsatisfied assertions, only visit the
+     * unsatisfied roots rather than all assertions */
+    for (i = 0; i < BZLA_COUNT_STACK(slv->roots_stack); i++)
     {
-      d  = (BzlaSLSConstrData *) slv->weights->data[it.cur_pos].as_ptr;
-      id = bzla_iter_hashint_next(&it);
+      id = BZLA_PEEK_STACK(slv->roots_stack, i);
       assert(bzla_hashint_table_contains(slv->score, id));
-      if (bzla_hashint_map_get(slv->score, id)->as_dbl == 1.0) continue;
+      assert(bzla_hashint_map_get(slv->score, id)->as_dbl < 1.0);
+      d = (BzlaSLSConstrData *) bzla_hashint_map_get(slv->weights, id)->as_ptr;
       d->weight += 1;
     }
   }
@@ -348,6 +343,7 @@ try_move(Bzla *bzla,
   bzla_lsutils_update_cone(bzla,
                            bv_model,
                            slv->roots,
+                           &slv->roots_stack,
                            score,
                            cans,
                            false,
@@ -1254,6 +1250,7 @@ move(Bzla *bzla, uint32_t nmoves)
   bzla_lsutils_update_cone(bzla,
                            bzla->bv_model,
                            slv->roots,
+                           &slv->roots_stack,
                            slv->score,
                            slv->max_cans,
                            true,
@@ -1359,6 +1356,11 @@ clone_sls_solver(Bzla *clone, BzlaSLSSolver *slv, BzlaNodeMap *exp_map)
 
   res->bzla  = clone;
   res->roots = bzla_hashint_map_clone(clone->mm, slv->roots, 0, 0);
+  BZLA_INIT_STACK(clone->mm, res->roots_stack);
+  for (i = 0; i < BZLA_COUNT_STACK(slv->roots_stack); i++)
+  {
+    BZLA_PUSH_STACK(res->roots_stack, BZLA_PEEK_STACK(slv->roots_stack, i));
+  }
   res->score =
       bzla_hashint_map_clone(clone->mm, slv->score, bzla_clone_data_as_dbl, 0);
 
@@ -1406,6 +1408,7 @@ delete_sls_solver(BzlaSLSSolver *slv)
 
   if (slv->score) bzla_hashint_map_delete(slv->score);
   if (slv->roots) bzla_hashint_map_delete(slv->roots);
+  BZLA_RELEASE_STACK(slv->roots_stack);
   bzla_iter_hashint_init(&it, slv->domains);
   while (bzla_iter_hashint_has_next(&it))
   {
@@ -1536,6 +1539,7 @@ sat_sls_solver(BzlaSLSSolver *slv)
 
     /* collect unsatisfied roots (kept up-to-date in update_cone) */
     assert(!slv->roots);
+    assert(BZLA_EMPTY_STACK(slv->roots_stack));
     slv->roots = bzla_hashint_map_new(bzla->mm);
     bzla_iter_hashptr_init(&pit, bzla->unsynthesized_constraints);
     bzla_iter_hashptr_queue(&pit, bzla->synthesized_constraints);
@@ -1548,7 +1552,8 @@ sat_sls_solver(BzlaSLSSolver *slv)
       {
         if (bzla_node_is_bv_const(root))
           goto UNSAT; /* contains false constraint -> unsat */
-        bzla_hashint_map_add(slv->roots, bzla_node_get_id(root));
+        bzla_lsutils_roots_add(
+            slv->roots, &slv->roots_stack, bzla_node_get_id(root));
       }
     }
 
@@ -1581,6 +1586,7 @@ sat_sls_solver(BzlaSLSSolver *slv)
     bzla_hashint_map_delete(slv->score);
     bzla_hashint_map_delete(slv->roots);
     slv->roots = 0;
+    BZLA_RESET_STACK(slv->roots_stack);
     slv->score = bzla_hashint_map_new(bzla->mm);
     slv->stats.restarts += 1;
   }
@@ -1598,6 +1604,7 @@ DONE:
     bzla_hashint_map_delete(slv->roots);
     slv->roots = 0;
   }
+  BZLA_RESET_STACK(slv->roots_stack);
   if (slv->weights)
   {
     bzla_iter_hashint_init(&iit, slv->weights);
@@ -1743,6 +1750,7 @@ bzla_new_sls_solver(Bzla *bzla)
   slv->kind    = BZLA_SLS_SOLVER_KIND;
   slv->domains = bzla_hashint_map_new(bzla->mm);
 
+  BZLA_INIT_STACK(bzla->mm, slv->roots_stack);
   BZLA_INIT_STACK(bzla->mm, slv->moves);
 
   slv->api.clone          = (BzlaSolverClone) clone_sls_solver;
@@ -59,8 +59,9 @@ struct BzlaSLSSolver
 {
   BZLA_SOLVER_STRUCT;
 
-  BzlaIntHashTable *roots;   /* must be map (for common local search funs)
-                                but does not maintain anything */
+  BzlaIntHashTable *roots;   /* maps unsatisfied roots to their position
+                                in 'roots_stack' */
+  BzlaIntStack roots_stack;  /* ids of all unsatisfied roots */
   BzlaIntHashTable *weights; /* also maintains assertion weights */
   BzlaIntHashTable *score;   /* sls score */
 
@@ -12,27 +12,87 @@
 
 #include "bzlacore.h"
 #include "bzlaexp.h"
+#include "bzlaopt.h"
 #include "utils/bzlanodeiter.h"
 #include "utils/bzlautil.h"
 
+uint64_t
+bzla_ackermann_cost(uint32_t num_applies)
+{
+  if (num_applies < 2) return 0;
+  return (uint64_t) num_applies * (num_applies - 1) / 2;
+}
+
+void
+bzla_ackermann_constraints(Bzla *bzla,
+                           BzlaNodePtrStack *applies,
+                           BzlaNodePtrStack *constraints)
+{
+  assert(bzla);
+  assert(applies);
+  assert(constraints);
+
+  uint32_t i, j;
+  BzlaNode *app_i, *app_j, *p, *c, *imp, *a_i, *a_j, *eq, *tmp;
+  BzlaArgsIterator ait_i, ait_j;
+
+  for (i = 0; i < BZLA_COUNT_STACK(*applies); i++)
+  {
+    app_i = BZLA_PEEK_STACK(*applies, i);
+    assert(bzla_node_is_regular(app_i));
+    assert(bzla_node_is_apply(app_i));
+    for (j = i + 1; j < BZLA_COUNT_STACK(*applies); j++)
+    {
+      app_j = BZLA_PEEK_STACK(*applies, j);
+      assert(app_i->e[0] == app_j->e[0]);
+      p = 0;
+      assert(bzla_node_get_sort_id(app_i->e[1])
+             == bzla_node_get_sort_id(app_j->e[1]));
+      bzla_iter_args_init(&ait_i, app_i->e[1]);
+      bzla_iter_args_init(&ait_j, app_j->e[1]);
+      while (bzla_iter_args_has_next(&ait_i))
+      {
+        a_i = bzla_iter_args_next(&ait_i);
+        a_j = bzla_iter_args_next(&ait_j);
+        eq  = bzla_exp_eq(bzla, a_i, a_j);
+
+        if (!p)
+          p = eq;
+        else
+        {
+          tmp = p;
+          p   = bzla_exp_bv_and(bzla, tmp, eq);
+          bzla_node_release(bzla, tmp);
+          bzla_node_release(bzla, eq);
+        }
+      }
+      c   = bzla_exp_eq(bzla, app_i, app_j);
+      imp = bzla_exp_implies(bzla, p, c);
+      BZLA_PUSH_STACK(*constraints, imp);
+      bzla_node_release(bzla, p);
+      bzla_node_release(bzla, c);
+    }
+  }
+}
+
 void
 bzla_add_ackermann_constraints(Bzla *bzla)
 {
   assert(bzla);
 
-  uint32_t i, j, num_constraints = 0;
+  uint32_t i, num_constraints = 0, num_skipped = 0;
+  uint64_t limit;
   double start, delta;
-  BzlaNode *uf, *app_i, *app_j, *p, *c, *imp, *a_i, *a_j, *eq, *tmp;
-  BzlaNode *cur;
-  BzlaArgsIterator ait_i, ait_j;
+  BzlaNode *uf, *app, *cur;
   BzlaNodeIterator nit;
   BzlaPtrHashTableIterator it;
-  BzlaNodePtrStack applies, visit;
+  BzlaNodePtrStack applies, constraints, visit;
   BzlaIntHashTable *cache;
   BzlaMemMgr *mm;
 
   start = bzla_util_time_stamp();
   mm    = bzla->mm;
+  limit = bzla_opt_get(bzla, BZLA_OPT_PP_ACKERMANN_LIMIT);
   cache = bzla_hashint_table_new(mm);
   BZLA_INIT_STACK(mm, visit);
 
@@ -54,59 +114,44 @@ bzla_add_ackermann_constraints(Bzla *bzla)
   }
   BZLA_RELEASE_STACK(visit);
 
+  BZLA_INIT_STACK(mm, applies);
+  BZLA_INIT_STACK(mm, constraints);
   bzla_iter_hashptr_init(&it, bzla->ufs);
   while (bzla_iter_hashptr_has_next(&it))
   {
     uf = bzla_iter_hashptr_next(&it);
-    BZLA_INIT_STACK(bzla->mm, applies);
     bzla_iter_apply_parent_init(&nit, uf);
     while (bzla_iter_apply_parent_has_next(&nit))
     {
-      app_i = bzla_iter_apply_parent_next(&nit);
-      if (app_i->parameterized) continue;
-      if (!bzla_hashint_table_contains(cache, app_i->id)) continue;
-      BZLA_PUSH_STACK(applies, app_i);
+      app = bzla_iter_apply_parent_next(&nit);
+      if (app->parameterized) continue;
+      if (!bzla_hashint_table_contains(cache, app->id)) continue;
+      BZLA_PUSH_STACK(applies, app);
     }
 
-    for (i = 0; i < BZLA_COUNT_STACK(applies); i++)
+    /* functions with too many applications are handled via lemmas on
+     * demand */
+    if (limit && bzla_ackermann_cost(BZLA_COUNT_STACK(applies)) > limit)
     {
-      app_i = BZLA_PEEK_STACK(applies, i);
-      for (j = i + 1; j < BZLA_COUNT_STACK(applies); j++)
-      {
-        app_j = BZLA_PEEK_STACK(applies, j);
-        p     = 0;
-        assert(bzla_node_get_sort_id(app_i->e[1])
-               == bzla_node_get_sort_id(app_j->e[1]));
-        bzla_iter_args_init(&ait_i, app_i->e[1]);
-        bzla_iter_args_init(&ait_j, app_j->e[1]);
-        while (bzla_iter_args_has_next(&ait_i))
-        {
-          a_i = bzla_iter_args_next(&ait_i);
-          a_j = bzla_iter_args_next(&ait_j);
-          eq  = bzla_exp_eq(bzla, a_i, a_j);
-
-          if (!p)
-            p = eq;
-          else
-          {
-            tmp = p;
-            p   = bzla_exp_bv_and(bzla, tmp, eq);
-            bzla_node_release(bzla, tmp);
-            bzla_node_release(bzla, eq);
-          }
-        }
-        c   = bzla_exp_eq(bzla, app_i, app_j);
-        imp = bzla_exp_implies(bzla, p, c);
-        bzla->stats.ackermann_constraints++;
-        num_constraints++;
-        bzla_assert_exp(bzla, imp);
-        bzla_node_release(bzla, p);
-        bzla_node_release(bzla, c);
-        bzla_node_release(bzla, imp);
-      }
+      num_skipped++;
+      BZLA_RESET_STACK(applies);
+      continue;
+    }
+
+    bzla_ackermann_constraints(bzla, &applies, &constraints);
+    for (i = 0; i < BZLA_COUNT_STACK(constraints); i++)
+    {
+      cur = BZLA_PEEK_STACK(constraints, i);
+      bzla->stats.ackermann_constraints++;
+      num_constraints++;
+      bzla_assert_exp(bzla, cur);
+      bzla_node_release(bzla, cur);
     }
-    BZLA_RELEASE_STACK(applies);
+    BZLA_RESET_STACK(constraints);
+    BZLA_RESET_STACK(applies);
   }
+  BZLA_RELEASE_STACK(constraints);
+  BZLA_RELEASE_STACK(applies);
   bzla_hashint_table_delete(cache);
   delta = bzla_util_time_stamp() - start;
   BZLA_MSG(bzla->msg,
@@ -114,5 +159,10 @@ bzla_add_ackermann_constraints(Bzla *bzla)
            "added %d ackermann constraints in %.3f seconds",
            num_constraints,
            delta);
+  if (num_skipped)
+    BZLA_MSG(bzla->msg,
+             1,
+             "skipped %d functions exceeding ackermann limit",
+             num_skipped);
   bzla->time.ack += delta;
 }
@@ -11,8 +11,30 @@
 #ifndef BZLAACK_H_INCLUDED
 #define BZLAACK_H_INCLUDED
 
+#include "bzlanode.h"
 #include "bzlatypes.h"
 
+/**
+ * Add Ackermann constraints for all uninterpreted functions.
+ * If BZLA_OPT_PP_ACKERMANN_LIMIT is set, functions that require more
+ * constraints than the limit are skipped and left to lemmas on demand.
+ */
 void bzla_add_ackermann_constraints(Bzla* bzla);
 
+/**
+ * Return the number of Ackermann constraints required for a function with
+ * 'num_applies' applications.
+ */
+uint64_t bzla_ackermann_cost(uint32_t num_applies);
+
+/**
+ * Create the Ackermann constraints for all pairs of function applications
+ * on stack 'applies' (applications of the same function) and push them onto
+ * stack 'constraints'. The caller is responsible for releasing the pushed
+ * constraints.
+ */
+void bzla_ackermann_constraints(Bzla* bzla,
+                                BzlaNodePtrStack* applies,
+                                BzlaNodePtrStack* constraints);
+
 #endif
@@ -117,9 +117,20 @@ create_range(Bzla *bzla,
   int64_t pos;
   BzlaNode *res, *le0, *le1, *and, *off, *sub, *rem, *eq, *zero, *slice;
 
-  le0 = bzla_exp_bv_ulte(bzla, lower, param);
-  le1 = bzla_exp_bv_ulte(bzla, param, upper);
-  and = bzla_exp_bv_and(bzla, le0, le1);
+  if (bzla_node_is_bv_const(lower))
+  {
+    le0 = bzla_exp_bv_ulte(bzla, lower, param);
+    le1 = bzla_exp_bv_ulte(bzla, param, upper);
+    and = bzla_exp_bv_and(bzla, le0, le1);
+  }
+  /* relative addresses: base + l <= i <= base + u may wrap around,
+   * use i - (base + l) <= (base + u) - (base + l) instead */
+  else
+  {
+    le0 = bzla_exp_bv_sub(bzla, param, lower);
+    le1 = bzla_exp_bv_sub(bzla, upper, lower);
+    and = bzla_exp_bv_ulte(bzla, le0, le1);
+  }
 
   /* increment by one */
   if (bzla_bv_is_one(offset)) res = bzla_node_copy(bzla, and);
@@ -452,6 +463,32 @@ is_abs_set_pattern(BzlaNode *index, BzlaNode *prev_index)
          && (!prev_index || bzla_node_is_bv_const(prev_index));
 }
 
+/* index is of the form base + c with c constant */
+static bool
+is_rel_index(BzlaNode *index)
+{
+  return !bzla_node_is_inverted(index) && bzla_node_is_bv_add(index)
+         && (bzla_node_is_bv_const(index->e[0])
+             || bzla_node_is_bv_const(index->e[1]));
+}
+
+/* index and previous index are relative to the same (symbolic) base address,
+ * e.g., writes to base + 0, base + 1, ... (memset/memcpy with symbolic
+ * destination) */
+static bool
+is_rel_set_pattern(BzlaNode *index, BzlaNode *prev_index)
+{
+  BzlaNode *base, *prev_base;
+
+  if (!is_rel_index(index)) return false;
+  if (!prev_index) return true;
+  if (!is_rel_index(prev_index)) return false;
+
+  extract_base_addr_offset(index, &base, 0);
+  extract_base_addr_offset(prev_index, &prev_base, 0);
+  return base == prev_base;
+}
+
 static void
 add_to_index_map(Bzla *bzla,
                  BzlaPtrHashTable *map_value_index,
@@ -511,7 +548,9 @@ check_and_add_index(Bzla *bzla,
                     BzlaNode *value,
                     BzlaIntHashTable *index_cache)
 {
-  if (!is_abs_set_pattern(index, prev_index)) return false;
+  if (!is_abs_set_pattern(index, prev_index)
+      && !is_rel_set_pattern(index, prev_index))
+    return false;
 
   bzla_hashint_table_add(index_cache, bzla_node_get_id(index));
   add_to_index_map(bzla, map_value_index, fun, index, value);
@@ -566,7 +605,9 @@ collect_indices_updates(Bzla *bzla,
       cur_upd = top_upd = BZLA_POP_STACK(upd_nodes);
       prev_index = prev_value = 0;
 
-      if (bzla_hashint_table_contains(visit_cache, bzla_node_get_id(top_upd)))
+      if (bzla_hashint_table_contains(visit_cache, bzla_node_get_id(top_upd))
+          || bzla_hashint_table_contains(bzla->extract_cache,
+                                         bzla_node_get_id(top_upd)))
         continue;
 
       index_cache = bzla_hashint_table_new(bzla->mm);
@@ -651,6 +692,9 @@ collect_indices_lambdas(Bzla *bzla,
     /* already visited */
     if (bzla_hashptr_table_get(map_value_index, lambda)) continue;
 
+    /* no pattern found in previous calls */
+    if (bzla_hashint_table_contains(bzla->extract_cache, lambda->id)) continue;
+
     /* we only consider writes */
     if (!lambda->is_array || !bzla_node_lambda_get_static_rho(lambda)) continue;
 
@@ -1033,7 +1077,7 @@ extract_lambdas(Bzla *bzla,
 
   bool is_top_eq;
   BzlaBitVector *inc;
-  uint32_t i_range, i_index, i_value, i_inc, i_index_r;
+  uint32_t i_range, i_index, i_value, i_inc, i_index_r, num_prev;
   BzlaNode *subst, *base, *tmp, *array, *value, *lower, *upper;
   BzlaNode *src_array, *src_addr, *dst_addr;
   BzlaPtrHashTableIterator it, iit;
@@ -1314,8 +1358,17 @@ extract_lambdas(Bzla *bzla,
       }
     }
 
+    num_prev  = num_total;
     num_total = num_set + num_set_inc + num_set_itoi + num_set_itoip1 + num_cpy;
 
+    /* cache write chains without patterns, the same chain will not yield
+     * any patterns in subsequent incremental calls either */
+    if (!is_top_eq && num_total == num_prev
+        && !bzla_hashint_table_contains(bzla->extract_cache, array->id))
+    {
+      bzla_hashint_table_add(bzla->extract_cache, array->id);
+    }
+
     /* we can skip creating writes if we did not find any pattern in a write
      * chain, and thus can leave the write chain as-is.
      * for the top equality case we always have to create writes since we
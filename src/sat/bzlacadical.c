@@ -70,6 +70,18 @@ failed(BzlaSATMgr *smgr, int32_t lit)
   return ccadical_failed(smgr->solver, lit);
 }
 
+static int32_t
+fixed(BzlaSATMgr *smgr, int32_t lit)
+{
+  return ccadical_fixed(smgr->solver, lit);
+}
+
+static void
+phase(BzlaSATMgr *smgr, int32_t lit)
+{
+  ccadical_phase(smgr->solver, lit);
+}
+
 static void
 reset(BzlaSATMgr *smgr)
 {
@@ -80,7 +92,7 @@ reset(BzlaSATMgr *smgr)
 static int32_t
 sat(BzlaSATMgr *smgr, int32_t limit)
 {
-  (void) limit;
+  if (limit > -1) ccadical_limit(smgr->solver, "conflicts", limit);
   return ccadical_sat(smgr->solver);
 }
 
@@ -130,10 +142,11 @@ bzla_sat_enable_cadical(BzlaSATMgr *smgr)
   smgr->api.deref            = deref;
   smgr->api.enable_verbosity = enable_verbosity;
   smgr->api.failed           = failed;
-  smgr->api.fixed            = 0;
+  smgr->api.fixed            = fixed;
   smgr->api.inc_max_var      = 0;
   smgr->api.init             = init;
   smgr->api.melt             = 0;
+  smgr->api.phase            = phase;
   smgr->api.repr             = 0;
   smgr->api.reset            = reset;
   smgr->api.sat              = sat;
@@ -0,0 +1,7 @@
+(set-logic QF_BV)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(assert (= (bvand x #xf0) #x30))
+(assert (= (bvor y #x0f) #x5f))
+(assert (bvult x y))
+(check-sat)
@@ -0,0 +1,34 @@
+(set-logic QF_BV)
+(declare-const x0 (_ BitVec 16))
+(declare-const x1 (_ BitVec 16))
+(declare-const x2 (_ BitVec 16))
+(declare-const x3 (_ BitVec 16))
+(declare-const x4 (_ BitVec 16))
+(declare-const x5 (_ BitVec 16))
+(declare-const x6 (_ BitVec 16))
+(declare-const x7 (_ BitVec 16))
+(declare-const x8 (_ BitVec 16))
+(declare-const x9 (_ BitVec 16))
+(declare-const x10 (_ BitVec 16))
+(declare-const x11 (_ BitVec 16))
+(declare-const x12 (_ BitVec 16))
+(declare-const x13 (_ BitVec 16))
+(declare-const x14 (_ BitVec 16))
+(declare-const x15 (_ BitVec 16))
+(assert (= x0 #xffff))
+(assert (= x1 #xffff))
+(assert (= x2 #xffff))
+(assert (= x3 #xffff))
+(assert (= x4 #xffff))
+(assert (= x5 #xffff))
+(assert (= x6 #xffff))
+(assert (= x7 #xffff))
+(assert (= x8 #xffff))
+(assert (= x9 #xffff))
+(assert (= x10 #xffff))
+(assert (= x11 #xffff))
+(assert (= x12 #xffff))
+(assert (= x13 #xffff))
+(assert (= x14 #xffff))
+(assert (= x15 #xffff))
+(check-sat)
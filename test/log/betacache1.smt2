@@ -0,0 +1,20 @@
+(set-logic QF_BV)
+(set-option :incremental true)
+(define-fun f ((x (_ BitVec 8)) (y (_ BitVec 8))) (_ BitVec 8)
+  (ite (bvult x y) (bvadd x y) (ite (= x y) #x00 (bvsub x y))))
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+(assert (= (f a b) #x10))
+(check-sat)
+(push 1)
+(assert (bvult a b))
+(assert (= a #x08))
+(check-sat)
+(pop 1)
+(assert (bvugt a b))
+(check-sat)
+(check-sat-assuming ((= a b)))
+(assert (= (f b a) (f a #x00)))
+(check-sat)
+(check-sat-assuming ((= b #x01)))
+(exit)
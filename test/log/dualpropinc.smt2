@@ -0,0 +1,19 @@
+(set-logic QF_ABV)
+(set-option :incremental true)
+(declare-fun a () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun i () (_ BitVec 8))
+(declare-fun j () (_ BitVec 8))
+(assert (= (select a i) #x01))
+(check-sat)
+(assert (= (select a j) #x02))
+(check-sat)
+(push 1)
+(assert (= i j))
+(check-sat)
+(pop 1)
+(assert (bvult i j))
+(check-sat-assuming ((= (select (store a i #x03) j) #x02)))
+(assert (= (select a (bvadd i #x01)) #x05))
+(check-sat-assuming ((= j (bvadd i #x01))))
+(check-sat)
+(exit)
@@ -0,0 +1,16 @@
+(set-logic QF_ABV)
+(declare-fun p () Bool)
+(declare-fun q () Bool)
+(declare-fun a () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun b () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun c () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun d () (Array (_ BitVec 8) (_ BitVec 8)))
+(declare-fun k () (_ BitVec 8))
+(assert (or p (= a b)))
+(assert (or (not p) (= a c)))
+(assert (or q (= b d)))
+(assert (or (not q) (= c d)))
+(assert (= b c))
+(assert (distinct (select a k) (select d k)))
+(check-sat)
+(exit)
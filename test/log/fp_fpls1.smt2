@@ -0,0 +1,8 @@
+(set-logic QF_FP)
+(declare-const a Float32)
+(declare-const b Float32)
+(declare-const r RoundingMode)
+(assert (fp.eq (fp.add r a b) ((_ to_fp 8 24) RNE 3.0)))
+(assert (fp.gt a ((_ to_fp 8 24) RNE 1.0)))
+(assert (fp.isNormal b))
+(check-sat)
@@ -0,0 +1,12 @@
+(set-logic QF_FP)
+(set-option :produce-models true)
+(declare-const a Float16)
+(declare-const b Float16)
+(declare-const r RoundingMode)
+(assert (fp.eq a ((_ to_fp 5 11) RNE 2.0)))
+(assert (fp.eq b (fp.add r a a)))
+(assert (= r RTZ))
+(check-sat)
+(get-value (a))
+(get-value (b))
+(get-value ((fp.mul RNE a b)))
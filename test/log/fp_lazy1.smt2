@@ -0,0 +1,21 @@
+(set-logic QF_FP)
+(set-option :incremental true)
+(declare-const a Float16)
+(declare-const b Float16)
+(declare-const r RoundingMode)
+(define-fun one () Float16 ((_ to_fp 5 11) RNE 1.0))
+(define-fun two () Float16 ((_ to_fp 5 11) RNE 2.0))
+(assert (fp.isNormal a))
+(assert (fp.isNormal b))
+(check-sat-assuming ((not (fp.eq (fp.div r a a) one))))
+(check-sat-assuming ((fp.eq (fp.div RNE a b) two)))
+(push 1)
+(assert (fp.eq (fp.sqrt RNE a) two))
+(check-sat)
+(assert (fp.lt a one))
+(check-sat)
+(pop 1)
+(assert (fp.eq (fp.fma RNE a b one) two))
+(check-sat)
+(check-sat-assuming ((fp.isPositive a) (fp.eq a b) (fp.isNegative (fp.rem a b))))
+(exit)
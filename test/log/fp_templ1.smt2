@@ -0,0 +1,12 @@
+(set-logic QF_FP)
+(declare-const a Float16)
+(declare-const b Float16)
+(declare-const c Float16)
+(declare-const d Float16)
+(declare-const r RoundingMode)
+(assert (fp.eq (fp.add RNE a b) (fp.add RNE c d)))
+(assert (fp.eq (fp.mul r a c) (fp.mul r b d)))
+(assert (not (fp.isNaN (fp.div RTZ a b))))
+(assert (fp.lt (fp.sqrt r c) (fp.fma RNE a b d)))
+(assert (not (= a b)))
+(check-sat)
@@ -0,0 +1,11 @@
+(set-logic QF_FP)
+(declare-const a Float16)
+(declare-const b Float16)
+(declare-const r RoundingMode)
+(define-fun one () Float16 ((_ to_fp 5 11) RNE 1.0))
+(assert
+  (or (not (= (fp.add r a b) (fp.add r b a)))
+      (not (= (fp.mul RTN a b) (fp.mul RTN b a)))
+      (not (= (fp.fma r a one b) (fp.add r a b)))
+      (and (fp.isNormal a) (not (fp.eq (fp.div r a a) one)))))
+(check-sat)
@@ -0,0 +1,12 @@
+(set-logic QF_ABV)
+(declare-fun a () (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-fun c () (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-fun d () (_ BitVec 32))
+(declare-fun q () (_ BitVec 32))
+(declare-fun j () (_ BitVec 32))
+(define-fun b () (Array (_ BitVec 32) (_ BitVec 8)) (store (store (store (store (store (store (store (store a (bvadd d (_ bv1 32)) (select c (bvadd q (_ bv1 32)))) (bvadd d (_ bv2 32)) (select c (bvadd q (_ bv2 32)))) (bvadd d (_ bv3 32)) (select c (bvadd q (_ bv3 32)))) (bvadd d (_ bv4 32)) (select c (bvadd q (_ bv4 32)))) (bvadd d (_ bv5 32)) (select c (bvadd q (_ bv5 32)))) (bvadd d (_ bv6 32)) (select c (bvadd q (_ bv6 32)))) (bvadd d (_ bv7 32)) (select c (bvadd q (_ bv7 32)))) (bvadd d (_ bv8 32)) (select c (bvadd q (_ bv8 32)))))
+(assert (bvule (_ bv1 32) j))
+(assert (bvule j (_ bv8 32)))
+(assert (distinct (select b (bvadd d j)) (select c (bvadd q j))))
+(check-sat)
+(exit)
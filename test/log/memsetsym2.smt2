@@ -0,0 +1,10 @@
+(set-logic QF_ABV)
+(declare-fun a () (Array (_ BitVec 32) (_ BitVec 8)))
+(declare-fun p () (_ BitVec 32))
+(declare-fun j () (_ BitVec 32))
+(define-fun b () (Array (_ BitVec 32) (_ BitVec 8)) (store (store (store (store (store (store (store (store a (bvadd p (_ bv1 32)) #x2a) (bvadd p (_ bv2 32)) #x2a) (bvadd p (_ bv3 32)) #x2a) (bvadd p (_ bv4 32)) #x2a) (bvadd p (_ bv5 32)) #x2a) (bvadd p (_ bv6 32)) #x2a) (bvadd p (_ bv7 32)) #x2a) (bvadd p (_ bv8 32)) #x2a))
+(assert (bvule (_ bv1 32) j))
+(assert (bvule j (_ bv9 32)))
+(assert (distinct (select b (bvadd p j)) #x2a))
+(check-sat)
+(exit)
@@ -0,0 +1,12 @@
+(set-logic QF_UFBV)
+(declare-fun f ((_ BitVec 8)) (_ BitVec 8))
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun z () (_ BitVec 8))
+(assert (bvule x y))
+(assert (bvule y x))
+(assert (bvule y z))
+(assert (bvule z y))
+(assert (or (distinct (f x) (f y)) (distinct (f y) (f z))))
+(check-sat)
+(exit)
@@ -0,0 +1,12 @@
+(set-logic QF_UFBV)
+(declare-fun f ((_ BitVec 8)) (_ BitVec 8))
+(declare-fun x () (_ BitVec 8))
+(declare-fun y () (_ BitVec 8))
+(declare-fun z () (_ BitVec 8))
+(assert (bvule x y))
+(assert (bvule y z))
+(assert (= (f x) (bvadd (f y) #x01)))
+(assert (= (f y) (bvadd (f z) #x01)))
+(assert (= (f (bvadd x y)) (f z)))
+(check-sat)
+(exit)
@@ -111,6 +111,22 @@ def test_get_value(bzla):
     # TODO
     pass
 
+def test_get_values(env):
+    bzla = env.bzla
+    bzla.set_option(Option.PRODUCE_MODELS, 1)
+    bzla.set_option(Option.FUN_LAZY_MODEL, 1)
+    x = bzla.mk_const(env.bv8)
+    y = bzla.mk_const(env.bv8)
+    ones = bzla.mk_bv_ones(env.bv8)
+    bzla.assert_formula(bzla.mk_term(Kind.EQUAL, [x, ones]))
+    bzla.check_sat()
+    xy = bzla.mk_term(Kind.BV_ADD, [x, y])
+    values = bzla.get_values([x, y, xy])
+    assert len(values) == 3
+    assert bzla.get_value_str(values[0]) == "1" * 8
+    assert bzla.get_value_str(values[1]) == bzla.get_value_str(y)
+    assert bzla.get_value_str(values[2]) == bzla.get_value_str(xy)
+
 def test_get_value_str_bv(env):
     bzla = env.bzla
     bzla.set_option(Option.PRODUCE_MODELS, 1)
@@ -174,6 +190,25 @@ def test_get_value_str_array_const(env):
     # Default value is zero due to const array
     assert val["11111111"] == "0" * 32
 
+def test_get_array_value_ranges(env):
+    bzla = env.bzla
+    bzla.set_option(Option.PRODUCE_MODELS, 1)
+    bzla.set_option(Option.RW_LEVEL, 0)
+    zero = bzla.mk_bv_value(env.bv32, 0)
+    five = bzla.mk_bv_value(env.bv32, 5)
+    a = bzla.mk_const_array(bzla.mk_array_sort(env.bv8, env.bv32), zero)
+    for i in range(1, 4):
+        a = bzla.mk_term(Kind.ARRAY_STORE,
+                         [a, bzla.mk_bv_value(env.bv8, i), five])
+    bzla.check_sat()
+    ranges, default_value = bzla.get_array_value_ranges(a)
+    assert len(ranges) == 1
+    lower, upper, value = ranges[0]
+    assert bzla.get_value_str(lower) == "00000001"
+    assert bzla.get_value_str(upper) == "00000011"
+    assert bzla.get_value_str(value) == "0" * 29 + "101"
+    assert bzla.get_value_str(default_value) == "0" * 32
+
 def test_get_value_str_fun(env):
     bzla = env.bzla
     bzla.set_option(Option.PRODUCE_MODELS, 1)
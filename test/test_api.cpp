@@ -2813,6 +2813,23 @@ TEST_F(TestApi, get_value)
 //               "'get-value' is currently not supported with quantifiers");
 }
 
+TEST_F(TestApi, get_values)
+{
+  const BitwuzlaTerm *terms[3] = {d_bv_const1, d_not_bv_const1, d_bv_const8};
+  ASSERT_DEATH(bitwuzla_get_values(d_bzla, 3, terms), d_error_produce_models);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_FUN_LAZY_MODEL, 1);
+  ASSERT_DEATH(bitwuzla_get_values(nullptr, 3, terms), d_error_not_null);
+  ASSERT_DEATH(bitwuzla_get_values(d_bzla, 3, nullptr), d_error_not_null);
+  bitwuzla_assert(d_bzla, d_bv_const1);
+  ASSERT_EQ(bitwuzla_check_sat(d_bzla), BITWUZLA_SAT);
+
+  const BitwuzlaTerm **values = bitwuzla_get_values(d_bzla, 3, terms);
+  ASSERT_EQ(values[0], bitwuzla_get_value(d_bzla, d_bv_const1));
+  ASSERT_EQ(values[1], bitwuzla_get_value(d_bzla, d_not_bv_const1));
+  ASSERT_EQ(values[2], bitwuzla_get_value(d_bzla, d_bv_const8));
+}
+
 TEST_F(TestApi, get_bv_value)
 {
   ASSERT_DEATH(bitwuzla_get_bv_value(d_bzla, d_bv_one1),
@@ -2901,6 +2918,58 @@ TEST_F(TestApi, get_array_value)
   ASSERT_EQ(default_value, w);
 }
 
+TEST_F(TestApi, get_array_value_ranges)
+{
+  bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+
+  const BitwuzlaTerm *zero = bitwuzla_mk_bv_zero(d_bzla, d_bv_sort8);
+  const BitwuzlaTerm *five =
+      bitwuzla_mk_bv_value(d_bzla, d_bv_sort8, "5", BITWUZLA_BV_BASE_DEC);
+  const BitwuzlaTerm *seven =
+      bitwuzla_mk_bv_value(d_bzla, d_bv_sort8, "7", BITWUZLA_BV_BASE_DEC);
+  const BitwuzlaTerm *idx[6];
+  const char *idx_str[6] = {"1", "2", "3", "4", "10", "11"};
+  for (size_t ii = 0; ii < 6; ++ii)
+  {
+    idx[ii] = bitwuzla_mk_bv_value(
+        d_bzla, d_bv_sort32, idx_str[ii], BITWUZLA_BV_BASE_DEC);
+  }
+
+  /* [1, 3] -> 5, 4 -> 0 (default), 10 -> 7 */
+  const BitwuzlaTerm *stores =
+      bitwuzla_mk_const_array(d_bzla, d_arr_sort_bv, zero);
+  const BitwuzlaTerm *vals[5] = {five, five, five, zero, seven};
+  for (size_t ii = 0; ii < 5; ++ii)
+  {
+    stores = bitwuzla_mk_term3(
+        d_bzla, BITWUZLA_KIND_ARRAY_STORE, stores, idx[ii], vals[ii]);
+  }
+  bitwuzla_check_sat(d_bzla);
+
+  size_t size;
+  const BitwuzlaTerm **lowers, **uppers, **values;
+  const BitwuzlaTerm *default_value;
+  bitwuzla_get_array_value_ranges(
+      d_bzla, stores, &lowers, &uppers, &values, &size, &default_value);
+
+  ASSERT_EQ(size, 2);
+  ASSERT_EQ(lowers[0], idx[0]);
+  ASSERT_EQ(uppers[0], idx[2]);
+  ASSERT_EQ(values[0], five);
+  ASSERT_EQ(lowers[1], idx[4]);
+  ASSERT_EQ(uppers[1], idx[4]);
+  ASSERT_EQ(values[1], seven);
+  ASSERT_EQ(default_value, zero);
+
+  /* array reads are answered without computing the whole array model */
+  const BitwuzlaTerm *read1 = bitwuzla_mk_term2(
+      d_bzla, BITWUZLA_KIND_ARRAY_SELECT, stores, idx[1]);
+  const BitwuzlaTerm *read2 = bitwuzla_mk_term2(
+      d_bzla, BITWUZLA_KIND_ARRAY_SELECT, stores, idx[5]);
+  ASSERT_EQ(bitwuzla_get_value(d_bzla, read1), five);
+  ASSERT_EQ(bitwuzla_get_value(d_bzla, read2), zero);
+}
+
 TEST_F(TestApi, get_fun_value)
 {
   bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
@@ -12,6 +12,8 @@
 
 extern "C" {
 #include "bzlaconfig.h"
+#include "bzlaexp.h"
+#include "bzlamodel.h"
 }
 
 class TestModelGen : public TestFile
@@ -23,7 +25,10 @@ class TestModelGen : public TestFile
     d_check_log_file = false;
   }
 
-  void run_modelgen_test(const char* name, const char* ext, int32_t rwl)
+  void run_modelgen_test(const char* name,
+                         const char* ext,
+                         int32_t rwl,
+                         bool lazy = false)
   {
 #ifndef BZLA_WINDOWS_BUILD
     int32_t ret_val;
@@ -33,6 +38,7 @@ class TestModelGen : public TestFile
 
     bitwuzla_set_option(d_bzla, BITWUZLA_OPT_RW_LEVEL, rwl);
     bitwuzla_set_option(d_bzla, BITWUZLA_OPT_PRODUCE_MODELS, 1);
+    bitwuzla_set_option(d_bzla, BITWUZLA_OPT_FUN_LAZY_MODEL, lazy);
     d_get_model = true;
 
     run_test(name, ext, BITWUZLA_UNKNOWN);
@@ -157,3 +163,69 @@ TEST_F(TestModelGen, modelgen27)
 {
   run_modelgen_test("modelgen27", ".btor", 3);
 }
+
+TEST_F(TestModelGen, modelgen_lazy5)
+{
+  run_modelgen_test("modelgen5", ".btor", 3, true);
+}
+
+TEST_F(TestModelGen, modelgen_lazy10)
+{
+  run_modelgen_test("modelgen10", ".btor", 3, true);
+}
+
+TEST_F(TestModelGen, modelgen_lazy22)
+{
+  run_modelgen_test("modelgen22", ".btor", 3, true);
+}
+
+class TestModelGenLazy : public TestBzla
+{
+};
+
+TEST_F(TestModelGenLazy, array_read)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_PRODUCE_MODELS, 1);
+  bzla_opt_set(d_bzla, BZLA_OPT_FUN_LAZY_MODEL, 1);
+
+  BzlaSortId sort   = bzla_sort_bv(d_bzla, 32);
+  BzlaSortId asort  = bzla_sort_array(d_bzla, sort, sort);
+  BzlaNode *zero    = bzla_exp_bv_zero(d_bzla, sort);
+  BzlaNode *five    = bzla_exp_bv_unsigned(d_bzla, 5, sort);
+  BzlaNode *one     = bzla_exp_bv_unsigned(d_bzla, 1, sort);
+  BzlaNode *i       = bzla_exp_var(d_bzla, sort, "i");
+  BzlaNode *j       = bzla_exp_var(d_bzla, sort, "j");
+  BzlaNode *carr    = bzla_exp_const_array(d_bzla, asort, zero);
+  BzlaNode *arr     = bzla_exp_write(d_bzla, carr, one, five);
+  BzlaNode *read_i  = bzla_exp_read(d_bzla, arr, i);
+  BzlaNode *read_j  = bzla_exp_read(d_bzla, arr, j);
+  BzlaNode *eq      = bzla_exp_eq(d_bzla, read_i, five);
+  bzla_assert_exp(d_bzla, eq);
+  ASSERT_EQ(bzla_check_sat(d_bzla, -1, -1), BZLA_RESULT_SAT);
+
+  BzlaNode *val_i = bzla_model_get_value(d_bzla, read_i);
+  BzlaNode *val_j = bzla_model_get_value(d_bzla, read_j);
+  ASSERT_EQ(val_i, five);
+  /* 'j' is unconstrained and thus 0 in the model */
+  ASSERT_EQ(val_j, zero);
+  /* the read on 'j' was answered by the store chain lookup, without
+   * computing the model of the whole array */
+  ASSERT_FALSE(bzla_hashint_map_contains(
+      d_bzla->fun_model,
+      bzla_node_get_id(bzla_node_get_simplified(d_bzla, arr))));
+
+  bzla_node_release(d_bzla, val_i);
+  bzla_node_release(d_bzla, val_j);
+  bzla_node_release(d_bzla, eq);
+  bzla_node_release(d_bzla, read_j);
+  bzla_node_release(d_bzla, read_i);
+  bzla_node_release(d_bzla, arr);
+  bzla_node_release(d_bzla, carr);
+  bzla_node_release(d_bzla, j);
+  bzla_node_release(d_bzla, i);
+  bzla_node_release(d_bzla, one);
+  bzla_node_release(d_bzla, five);
+  bzla_node_release(d_bzla, zero);
+  bzla_sort_release(d_bzla, asort);
+  bzla_sort_release(d_bzla, sort);
+}
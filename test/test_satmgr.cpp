@@ -8,6 +8,8 @@
  * See COPYING for more information on using this software.
  */
 
+#include <vector>
+
 #include "test.h"
 
 extern "C" {
@@ -28,6 +30,34 @@ class TestSatMgr : public TestBzla
     bzla_sat_mgr_delete(d_smgr);
     TestBzla::TearDown();
   }
+
+  /* Encode pigeon hole problem with n + 1 pigeons and n holes (unsat). */
+  void add_pigeon_hole(uint32_t n)
+  {
+    std::vector<std::vector<int32_t>> p(n + 1, std::vector<int32_t>(n));
+    for (uint32_t i = 0; i <= n; ++i)
+    {
+      for (uint32_t j = 0; j < n; ++j)
+      {
+        p[i][j] = bzla_sat_mgr_next_cnf_id(d_smgr);
+        bzla_sat_add(d_smgr, p[i][j]);
+      }
+      bzla_sat_add(d_smgr, 0);
+    }
+    for (uint32_t j = 0; j < n; ++j)
+    {
+      for (uint32_t i = 0; i <= n; ++i)
+      {
+        for (uint32_t k = i + 1; k <= n; ++k)
+        {
+          bzla_sat_add(d_smgr, -p[i][j]);
+          bzla_sat_add(d_smgr, -p[k][j]);
+          bzla_sat_add(d_smgr, 0);
+        }
+      }
+    }
+  }
+
   BzlaSATMgr *d_smgr = nullptr;
 };
 
@@ -42,3 +72,41 @@ TEST_F(TestSatMgr, next_cnf_id)
   ASSERT_EQ(bzla_sat_mgr_next_cnf_id(d_smgr), 4);
   bzla_sat_reset(d_smgr);
 }
+
+TEST_F(TestSatMgr, cadical_limit)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  add_pigeon_hole(5);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, 0), BZLA_RESULT_UNKNOWN);
+  bzla_sat_reset(d_smgr);
+}
+
+TEST_F(TestSatMgr, cadical_no_limit)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  bzla_sat_init(d_smgr);
+  add_pigeon_hole(5);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_UNSAT);
+  bzla_sat_reset(d_smgr);
+}
+
+TEST_F(TestSatMgr, cadical_phase)
+{
+  bzla_opt_set(d_bzla, BZLA_OPT_SAT_ENGINE, BZLA_SAT_ENGINE_CADICAL);
+  bzla_sat_enable_solver(d_smgr);
+  ASSERT_TRUE(bzla_sat_mgr_has_phase_support(d_smgr));
+  bzla_sat_init(d_smgr);
+  int32_t a = bzla_sat_mgr_next_cnf_id(d_smgr);
+  int32_t b = bzla_sat_mgr_next_cnf_id(d_smgr);
+  bzla_sat_add(d_smgr, a);
+  bzla_sat_add(d_smgr, b);
+  bzla_sat_add(d_smgr, 0);
+  bzla_sat_phase(d_smgr, -a);
+  bzla_sat_phase(d_smgr, b);
+  ASSERT_EQ(bzla_sat_check_sat(d_smgr, -1), BZLA_RESULT_SAT);
+  ASSERT_TRUE(bzla_sat_deref(d_smgr, a) > 0 || bzla_sat_deref(d_smgr, b) > 0);
+  bzla_sat_reset(d_smgr);
+}